@@ -0,0 +1,177 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <zkp-volte-patarin-nachef/params.h>
+#include <zkp-volte-patarin-nachef/protocol.h>
+
+#include "../src/commitment.h"
+
+#define N_ROUNDS 2000
+#define N_COMMITMENTS 200000
+
+typedef struct {
+  const char* id;
+  const zkp_params* (*params)(void);
+} bench_params;
+
+static const bench_params all_params[] = {
+  { "3x3x3", zkp_params_3x3x3 },   { "5x5x5", zkp_params_5x5x5 },
+  { "s41", zkp_params_s41 },       { "s41ast", zkp_params_s41ast },
+  { "s43ast", zkp_params_s43ast }, { "s53ast", zkp_params_s53ast },
+};
+
+// Replays the same random choices in each run, see ZKP_INSECURE_SEED_SIZE.
+static int deterministic = 0;
+static const unsigned char seed[ZKP_INSECURE_SEED_SIZE] = { 0 };
+
+// The commitment scheme of all proofs and verifications.
+static zkp_commitment_scheme scheme = ZKP_COMMITMENT_HMAC_SHA256;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static void bench(const zkp_params* params) {
+  const zkp_private_key* private_key =
+      deterministic ? zkp_insecure_generate_private_key(params, seed)
+                    : zkp_generate_private_key(params);
+  assert(private_key);
+  const zkp_public_key* public_key = zkp_compute_public_key(private_key);
+  assert(public_key);
+  int ok = zkp_prepare_public_key(public_key);
+  assert(ok);
+  (void) ok;
+  zkp_proof* proof = zkp_new_proof(private_key);
+  assert(proof);
+  zkp_verification* verification = zkp_new_verification(public_key);
+  assert(verification);
+  if (deterministic) {
+    ok = zkp_insecure_seed_proof(proof, seed) &&
+         zkp_insecure_seed_verification(verification, seed);
+    assert(ok);
+  }
+  ok = zkp_set_proof_commitment_scheme(proof, scheme) &&
+       zkp_set_verification_commitment_scheme(verification, scheme);
+  assert(ok);
+
+  double t_begin_round = 0, t_get_answer = 0, t_verify = 0;
+  for (unsigned int round = 0; round < N_ROUNDS; round++) {
+    double t0 = now_ns();
+    const unsigned char* commitments = zkp_begin_round(proof);
+    double t1 = now_ns();
+    unsigned int q = zkp_choose_question(verification);
+    double t2 = now_ns();
+    zkp_answer* answer = zkp_get_answer(proof, q);
+    double t3 = now_ns();
+    ok = zkp_verify(verification, commitments, answer);
+    double t4 = now_ns();
+    assert(ok);
+    (void) ok;
+    t_begin_round += t1 - t0;
+    t_get_answer += t3 - t2;
+    t_verify += t4 - t3;
+  }
+
+  printf("%-20s %12.2f %12.2f %12.2f\n", zkp_get_params_name(params),
+         t_begin_round / N_ROUNDS / 1000, t_get_answer / N_ROUNDS / 1000,
+         t_verify / N_ROUNDS / 1000);
+
+  zkp_free_verification(verification);
+  zkp_free_proof(proof);
+  zkp_free_public_key(public_key);
+  zkp_free_private_key(private_key);
+}
+
+// Measures the throughput of each commitment scheme for the sizes of the
+// representations of all parameters, with single messages and with batches as
+// large as those of zkp_begin_round.
+static void bench_commitments(void) {
+  static const size_t sizes[] = { 41, 43, 48, 53, 576 };
+  enum { batch_size = 32, max_size = 576 };
+  static unsigned char keys[batch_size][COMMITMENT_SIZE];
+  static unsigned char messages[batch_size][max_size];
+  static unsigned char out[batch_size][COMMITMENT_SIZE];
+  const unsigned char* key_ptrs[batch_size];
+  const unsigned char* message_ptrs[batch_size];
+  for (unsigned int i = 0; i < batch_size; i++) {
+    memset(keys[i], i, COMMITMENT_SIZE);
+    memset(messages[i], i, max_size);
+    key_ptrs[i] = keys[i];
+    message_ptrs[i] = messages[i];
+  }
+  const commitment_scheme* schemes[] = { &commitment_hmac_sha256,
+                                         &commitment_sha256 };
+  const unsigned int batch_sizes[] = { 1, batch_size };
+
+  printf("\n%-20s", "commitments");
+  for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    printf(" %9zu B", sizes[s]);
+  }
+  printf("\n%-20s", "");
+  for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    printf(" %11s", "[M/s]");
+  }
+  printf("\n");
+  static commitment_engine engine;
+  for (unsigned int c = 0; c < sizeof(schemes) / sizeof(schemes[0]); c++) {
+    init_commitment_engine(&engine, schemes[c]);
+    for (unsigned int b = 0; b < 2; b++) {
+      printf("%-14s x%-5u", schemes[c]->name, batch_sizes[b]);
+      for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        const unsigned int n_batches = N_COMMITMENTS / batch_sizes[b];
+        double t0 = now_ns();
+        for (unsigned int i = 0; i < n_batches; i++) {
+          commit_batch(&engine, key_ptrs, message_ptrs, sizes[s],
+                       batch_sizes[b], out[0]);
+        }
+        double t1 = now_ns();
+        printf(" %11.2f", n_batches * batch_sizes[b] / (t1 - t0) * 1000);
+      }
+      printf("\n");
+    }
+  }
+}
+
+static int selected(int argc, char** argv, const char* id) {
+  int any = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--", 2) == 0) {
+      continue;
+    }
+    if (strcmp(argv[i], id) == 0) {
+      return 1;
+    }
+    any = 1;
+  }
+  return !any;
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--deterministic") == 0) {
+      deterministic = 1;
+    } else if (strcmp(argv[i], "--sha256-commitments") == 0) {
+      scheme = ZKP_COMMITMENT_SHA256;
+    }
+  }
+  printf("%-20s %12s %12s %12s\n", "params", "begin_round", "get_answer",
+         "verify");
+  printf("%-20s %12s %12s %12s\n", "", "[us]", "[us]", "[us]");
+  for (unsigned int i = 0; i < sizeof(all_params) / sizeof(all_params[0]);
+       i++) {
+    if (selected(argc, argv, all_params[i].id)) {
+      // Initialize the parameters outside of the measurement.
+      bench(all_params[i].params());
+    }
+  }
+  if (selected(argc, argv, "commitments")) {
+    bench_commitments();
+  }
+  return 0;
+}
@@ -12,19 +12,19 @@
   });
 
   Promise.all([sodiumReady, loadWasmModule]).then(([_, wasmModule]) => {
-    function instantiateWasm(hmacStats) {
+    function instantiateWasm() {
       let instance;
       return WebAssembly.instantiate(wasmModule, {
         crypto: {
+          // Only imported unless the module is built with -DZKP_BUILTIN_CRYPTO.
           hmacSHA256(keyPtr, dataPtr, dataSize, outPtr) {
             const mem = new Uint8Array(instance.exports.memory.buffer);
-            const key = mem.slice(keyPtr, keyPtr + 32);
-            const data = mem.slice(dataPtr, dataPtr + dataSize);
+            const key = mem.subarray(keyPtr, keyPtr + 32);
+            const data = mem.subarray(dataPtr, dataPtr + dataSize);
             const hmac = window.sodium.crypto_auth_hmacsha256_init(key);
             window.sodium.crypto_auth_hmacsha256_update(hmac, data);
             const digest = window.sodium.crypto_auth_hmacsha256_final(hmac);
             mem.set(digest, outPtr);
-            hmacStats[hmacStats.currentContext]++;
           },
           randomBytes(ptr, size) {
             const bytes = window.sodium.randombytes_buf(size);
@@ -46,8 +46,7 @@
     }
 
     function createInstance(paramsFn) {
-      const hmacStats = {
-        currentContext: undefined,
+      const commitmentStats = {
         prover: 0,
         verifier: 0
       };
@@ -56,7 +55,7 @@
         verifier: 0
       };
 
-      return instantiateWasm(hmacStats).then((wasm) => {
+      return instantiateWasm().then((wasm) => {
         function readNullTerminatedString(ptr) {
           const view = new Uint8Array(wasm.exports.memory.buffer, ptr);
           const strlen = view.indexOf(0);
@@ -82,14 +81,15 @@
         let reachedThreshold = false;
         let nRounds = 0;
         function doOneRound() {
-          hmacStats.currentContext = 'prover';
           const commitments = wasm.exports.zkp_begin_round(proof);
-          transferStats.prover += wasm.exports.zkp_get_commitments_size(paramsPtr);
+          const commitmentsSize = wasm.exports.zkp_get_commitments_size(paramsPtr);
+          transferStats.prover += commitmentsSize;
+          commitmentStats.prover += commitmentsSize / 32;
           const q = wasm.exports.zkp_choose_question(verification);
           transferStats.verifier++;
           const answer = wasm.exports.zkp_get_answer(proof, q);
           transferStats.prover += wasm.exports.zkp_get_answer_size(paramsPtr, q);
-          hmacStats.currentContext = 'verifier';
+          commitmentStats.verifier += q === 0 ? 3 : 2;
           const ok = wasm.exports.zkp_verify(verification, commitments, answer);
           if (!ok) {
             throw new Error('Verification failed');
@@ -127,8 +127,8 @@
           vmHeapCell.textContent = `${(wasm.exports.memory.buffer.byteLength / 1024 / 1024).toFixed(1)} MiB`;
           transferProverCell.textContent = `${(transferStats.prover / 1024).toFixed(1)} KiB`;
           transferVerifierCell.textContent = `${(transferStats.verifier / 1024).toFixed(1)} KiB`;
-          nCommitmentsProverCell.textContent = `${hmacStats.prover}`;
-          nCommitmentsVerifierCell.textContent = `${hmacStats.verifier}`;
+          nCommitmentsProverCell.textContent = `${commitmentStats.prover}`;
+          nCommitmentsVerifierCell.textContent = `${commitmentStats.verifier}`;
         }
 
         updateRow();
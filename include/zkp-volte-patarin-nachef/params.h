@@ -27,6 +27,27 @@ const zkp_params* zkp_params_3x3x3(void);
  */
 const zkp_params* zkp_params_5x5x5(void);
 
+/**
+ * Sets the directory in which the precomputed tables of the parameter sets
+ * S41, S41*, S43*, and S53* are cached.
+ *
+ * If a valid cache file exists when one of these parameter sets is first used,
+ * its tables are mapped into memory and shared with all other processes that
+ * use the same file. Otherwise, the tables are computed and the cache file is
+ * written. This function must be called before the parameter sets are first
+ * used. By default, no cache is used.
+ *
+ * The directory must be trusted: only the library may write to it. A cache
+ * file replaces the public tables F and H of the parameter set wholesale, so
+ * anyone who can write it can substitute different parameters. Files are
+ * checked for corruption and for tables that could make lookups misbehave,
+ * but not for authenticity.
+ *
+ * @param path the directory, which must exist, or NULL to disable the cache
+ * @return 1 on success, 0 if memory could not be allocated
+ */
+int zkp_set_table_cache_directory(const char* path);
+
 #define ZKP_PARAMS_S41_DOMAIN 41
 #define ZKP_PARAMS_S41_ALPHA 9240
 #define ZKP_PARAMS_S41_H_ORDER 9240
@@ -75,4 +96,19 @@ const zkp_params* zkp_params_s43ast(void);
  */
 const zkp_params* zkp_params_s53ast(void);
 
+/**
+ * Initializes all parameter sets, including their precomputed tables.
+ *
+ * Parameter sets are initialized on first use otherwise, which may be called
+ * from any thread, but delays that use. Servers can call this function at
+ * startup instead. Tables that are not found in the table cache are computed
+ * by the given number of threads, one for each processor core is a good
+ * choice. This function should be called before other threads use any
+ * parameter sets, since the number of threads only affects initialization that
+ * has not started yet.
+ *
+ * @param n_threads the number of threads, where 0 is the same as 1
+ */
+void zkp_params_preload(unsigned int n_threads);
+
 #endif  // ZKP_VOLTE_PATARIN_NACHEF_PARAMS_H
@@ -1,6 +1,8 @@
 #ifndef ZKP_VOLTE_PATARIN_NACHEF_PROTOCOL_H
 #define ZKP_VOLTE_PATARIN_NACHEF_PROTOCOL_H
 
+#include <stddef.h>
+
 /**
  * Represents parameters for the protocol.
  */
@@ -31,6 +33,23 @@ typedef struct zkp_verification_s zkp_verification;
  */
 typedef struct zkp_answer_s zkp_answer;
 
+/**
+ * A cache of imported and prepared public keys, which may be shared by any
+ * number of threads.
+ */
+typedef struct zkp_public_key_cache_s zkp_public_key_cache;
+
+/**
+ * Statistics of a public key cache.
+ */
+typedef struct {
+  unsigned long long hits;
+  unsigned long long misses;
+  unsigned long long evictions;
+  unsigned int n_keys;
+  size_t memory_used;
+} zkp_public_key_cache_stats;
+
 /**
  * Returns the human-readable name associated with a given parameter set.
  *
@@ -127,6 +146,17 @@ const zkp_public_key* zkp_import_public_key(const zkp_params* params,
 void zkp_export_public_key(const zkp_public_key* key,
                            unsigned char* key_material);
 
+/**
+ * Precomputes the parts of verifications that only depend on the public key.
+ *
+ * This is optional and only pays off if the key is used to verify many rounds.
+ * It must not be called concurrently with any other use of the key.
+ *
+ * @param key the public key
+ * @return 1 on success, 0 if the required memory could not be allocated
+ */
+int zkp_prepare_public_key(const zkp_public_key* key);
+
 /**
  * Frees a public key.
  *
@@ -171,6 +201,18 @@ const unsigned char* zkp_begin_round(zkp_proof* proof);
  */
 zkp_answer* zkp_get_answer(zkp_proof* proof, unsigned int q);
 
+/**
+ * Exports an answer, such that it can be verified with zkp_import_verify.
+ *
+ * Use zkp_get_answer_size() to determine the required size of the buffer.
+ *
+ * @param params the parameters
+ * @param answer the answer
+ * @param bytes a buffer to hold the answer
+ */
+void zkp_export_answer(const zkp_params* params, const zkp_answer* answer,
+                       unsigned char* bytes);
+
 /**
  * Releases resources that were allocated for a proof.
  *
@@ -237,4 +279,137 @@ double zkp_get_impersonation_probability(zkp_verification* verification);
  */
 void zkp_free_verification(zkp_verification* verification);
 
+/**
+ * The schemes that the prover can use to commit to the secrets of each round.
+ *
+ * All parameters use ZKP_COMMITMENT_HMAC_SHA256 unless another scheme is
+ * selected. ZKP_COMMITMENT_SHA256 computes SHA-256(k || m) instead of
+ * HMAC-SHA256(k, m), which takes a single pass over the random key k and the
+ * message m, and is thus considerably faster for short messages. Both produce
+ * commitments of the same size, but the prover and the verifier must agree on
+ * the scheme.
+ */
+typedef enum {
+  ZKP_COMMITMENT_HMAC_SHA256 = 0,
+  ZKP_COMMITMENT_SHA256 = 1,
+} zkp_commitment_scheme;
+
+/**
+ * Selects the commitment scheme of all subsequent rounds of a proof.
+ *
+ * @param proof the zkp_proof instance
+ * @param scheme the commitment scheme
+ * @return 1 on success, 0 if the scheme is unknown
+ */
+int zkp_set_proof_commitment_scheme(zkp_proof* proof,
+                                    zkp_commitment_scheme scheme);
+
+/**
+ * Selects the commitment scheme that subsequent calls of zkp_verify and
+ * zkp_import_verify expect.
+ *
+ * @param verification the zkp_verification instance
+ * @param scheme the commitment scheme
+ * @return 1 on success, 0 if the scheme is unknown
+ */
+int zkp_set_verification_commitment_scheme(zkp_verification* verification,
+                                           zkp_commitment_scheme scheme);
+
+/**
+ * Creates a cache of public keys for the given parameters.
+ *
+ * The cache evicts approximately the least recently used key whenever the
+ * estimated memory that is used by the cached keys, including one
+ * verification for each key and the hash table that holds them, would exceed
+ * the budget. The budget does not cover the cache object itself, whose size is
+ * fixed and a few kilobytes.
+ *
+ * The returned object must be deallocated using zkp_free_public_key_cache.
+ *
+ * @param params the parameters
+ * @param memory_budget the maximum memory to be used by cached keys, in bytes
+ * @return the created cache, or NULL if the budget does not suffice for a
+ *         single key
+ */
+zkp_public_key_cache* zkp_new_public_key_cache(const zkp_params* params,
+                                               size_t memory_budget);
+
+/**
+ * Creates a new instance of the zkp_verification struct for use with the
+ * public key that is represented by the key material.
+ *
+ * The public key is only imported and prepared (see zkp_prepare_public_key) if
+ * it is not in the cache yet, and verifications of the key that have been
+ * freed are reused.
+ *
+ * The returned object must be deallocated using zkp_free_verification, which
+ * may happen after the cache has been freed.
+ *
+ * @param cache the public key cache
+ * @param key_material an octet sequence that represents a public key
+ * @return the created zkp_verification instance, or NULL if the key material
+ *         is invalid
+ */
+zkp_verification* zkp_new_cached_verification(
+    zkp_public_key_cache* cache, const unsigned char* key_material);
+
+/**
+ * Retrieves the statistics of a public key cache.
+ *
+ * @param cache the public key cache
+ * @param stats the statistics
+ */
+void zkp_get_public_key_cache_stats(zkp_public_key_cache* cache,
+                                    zkp_public_key_cache_stats* stats);
+
+/**
+ * Releases resources that were allocated for a public key cache.
+ *
+ * @param cache the public key cache
+ */
+void zkp_free_public_key_cache(zkp_public_key_cache* cache);
+
+/**
+ * The size of the seeds of the insecure deterministic mode, in bytes.
+ *
+ * In this mode, all random choices of a private key, proof, or verification
+ * are derived from a seed, such that runs can be replayed bit by bit, for
+ * example for benchmarks or to generate test vectors. It must never be used in
+ * production, since anyone who knows or guesses the seed can impersonate the
+ * prover or predict the questions of the verifier.
+ */
+#define ZKP_INSECURE_SEED_SIZE 32
+
+/**
+ * Generates a private key that is derived from the given seed. This is
+ * insecure, see ZKP_INSECURE_SEED_SIZE.
+ *
+ * @param params the parameters
+ * @param seed ZKP_INSECURE_SEED_SIZE bytes
+ * @return the generated private key
+ */
+const zkp_private_key* zkp_insecure_generate_private_key(
+    const zkp_params* params, const unsigned char* seed);
+
+/**
+ * Derives all subsequent random choices of the proof from the given seed. This
+ * is insecure, see ZKP_INSECURE_SEED_SIZE.
+ *
+ * @param proof the zkp_proof instance
+ * @param seed ZKP_INSECURE_SEED_SIZE bytes
+ * @return 1 on success, 0 if the required memory could not be allocated
+ */
+int zkp_insecure_seed_proof(zkp_proof* proof, const unsigned char* seed);
+
+/**
+ * Derives all subsequent questions of the verification from the given seed.
+ * This is insecure, see ZKP_INSECURE_SEED_SIZE.
+ *
+ * @param verification the zkp_verification instance
+ * @param seed ZKP_INSECURE_SEED_SIZE bytes
+ * @return 1 on success, 0 if the required memory could not be allocated
+ */
+int zkp_insecure_seed_verification(zkp_verification* verification,
+                                   const unsigned char* seed);
+
 #endif  // ZKP_VOLTE_PATARIN_NACHEF_PROTOCOL_H
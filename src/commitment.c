@@ -1,27 +1,623 @@
 #include "commitment.h"
 
-#ifndef __WASM__
+#include <string.h>
 
-#include <assert.h>
-#include <openssl/hmac.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(__WASM__)
+#define HAVE_X86_SHA256_KERNELS
+#include <immintrin.h>
+#endif
+
+static const uint32_t sha256_k[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+  0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+  0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+  0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+  0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+  0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static const uint32_t sha256_iv[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
 
-static inline void hmac_sha256(const unsigned char* key,
-                               const unsigned char* data, size_t data_size,
-                               unsigned char* out) {
-  unsigned char* ret =
-      HMAC(EVP_sha256(), key, COMMITMENT_SIZE, data, data_size, out, NULL);
-  assert(ret == out);
+static int always_supported(void) {
+  return 1;
 }
 
-#else
+static inline uint32_t load_be32(const unsigned char* p) {
+  return (uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 |
+         (uint32_t) p[3];
+}
+
+static inline void store_be32(unsigned char* p, uint32_t v) {
+  p[0] = (unsigned char) (v >> 24);
+  p[1] = (unsigned char) (v >> 16);
+  p[2] = (unsigned char) (v >> 8);
+  p[3] = (unsigned char) v;
+}
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void compress_scalar(uint32_t* states, const unsigned char* const* data,
+                            size_t n_blocks) {
+  const unsigned char* block = data[0];
+  for (size_t i = 0; i < n_blocks; i++, block += SHA256_BLOCK_SIZE) {
+    uint32_t w[64];
+    for (unsigned int t = 0; t < 16; t++) {
+      w[t] = load_be32(block + 4 * t);
+    }
+    for (unsigned int t = 16; t < 64; t++) {
+      const uint32_t s0 = SHA256_ROTR(w[t - 15], 7) ^
+                          SHA256_ROTR(w[t - 15], 18) ^ (w[t - 15] >> 3);
+      const uint32_t s1 = SHA256_ROTR(w[t - 2], 17) ^
+                          SHA256_ROTR(w[t - 2], 19) ^ (w[t - 2] >> 10);
+      w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+    uint32_t a = states[0], b = states[1], c = states[2], d = states[3];
+    uint32_t e = states[4], f = states[5], g = states[6], h = states[7];
+    for (unsigned int t = 0; t < 64; t++) {
+      const uint32_t s1 =
+          SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25);
+      const uint32_t ch = (e & f) ^ (~e & g);
+      const uint32_t t1 = h + s1 + ch + sha256_k[t] + w[t];
+      const uint32_t s0 =
+          SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22);
+      const uint32_t maj = (a & b) | (c & (a | b));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + s0 + maj;
+    }
+    states[0] += a;
+    states[1] += b;
+    states[2] += c;
+    states[3] += d;
+    states[4] += e;
+    states[5] += f;
+    states[6] += g;
+    states[7] += h;
+  }
+}
+
+static const sha256_kernels sha256_kernels_scalar = {
+  .name = "scalar",
+  .is_supported = always_supported,
+  .lanes = 1,
+  .cost = 5,
+  .compress = compress_scalar,
+};
+
+#ifdef HAVE_X86_SHA256_KERNELS
+
+#define SHANI_TARGET __attribute__((target("sha,sse4.1")))
+
+// The state is kept as ABEF and CDGH, the layout that sha256rnds2 expects.
+SHANI_TARGET static void compress_shani(uint32_t* states,
+                                        const unsigned char* const* data,
+                                        size_t n_blocks) {
+  const __m128i bswap =
+      _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) states),
+                                  0xb1);
+  __m128i state1 =
+      _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (states + 4)), 0x1b);
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+  state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+  const unsigned char* block = data[0];
+  for (size_t i = 0; i < n_blocks; i++, block += SHA256_BLOCK_SIZE) {
+    const __m128i abef = state0, cdgh = state1;
+    // msg[j % 4] holds the words 4 * j, ..., 4 * j + 3 of the schedule.
+    __m128i msg[4];
+    for (unsigned int j = 0; j < 16; j++) {
+      __m128i m;
+      if (j < 4) {
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*) (block + 16 * j)), bswap);
+      } else {
+        m = _mm_sha256msg1_epu32(msg[j % 4], msg[(j + 1) % 4]);
+        m = _mm_add_epi32(
+            m, _mm_alignr_epi8(msg[(j + 3) % 4], msg[(j + 2) % 4], 4));
+        m = _mm_sha256msg2_epu32(m, msg[(j + 3) % 4]);
+      }
+      msg[j % 4] = m;
+      const __m128i wk =
+          _mm_add_epi32(m, _mm_loadu_si128((const __m128i*) &sha256_k[4 * j]));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+      state0 = _mm_sha256rnds2_epu32(state0, state1,
+                                     _mm_shuffle_epi32(wk, 0x0e));
+    }
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1b);
+  state1 = _mm_shuffle_epi32(state1, 0xb1);
+  _mm_storeu_si128((__m128i*) states, _mm_blend_epi16(tmp, state1, 0xf0));
+  _mm_storeu_si128((__m128i*) (states + 4), _mm_alignr_epi8(state1, tmp, 8));
+}
+
+static int shani_supported(void) {
+  return __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("sha");
+}
+
+static const sha256_kernels sha256_kernels_shani = {
+  .name = "shani",
+  .is_supported = shani_supported,
+  .lanes = 1,
+  .cost = 1,
+  .compress = compress_shani,
+};
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+#define AVX512_TARGET __attribute__((target("avx2,avx512f")))
+
+// Loads the words 8 * half, ..., 8 * half + 7 of the blocks of eight lanes,
+// such that w[i] holds word 8 * half + i of all lanes.
+AVX2_TARGET static inline void load_words_x8(__m256i* w,
+                                             const unsigned char* const* blocks,
+                                             unsigned int half) {
+  const __m256i bswap = _mm256_set_epi64x(
+      0x0c0d0e0f08090a0bLL, 0x0405060700010203LL, 0x0c0d0e0f08090a0bLL,
+      0x0405060700010203LL);
+  __m256i r[8], t[8], u[8];
+  for (unsigned int l = 0; l < 8; l++) {
+    r[l] = _mm256_loadu_si256((const __m256i*) (blocks[l] + 32 * half));
+  }
+  for (unsigned int l = 0; l < 8; l += 2) {
+    t[l] = _mm256_unpacklo_epi32(r[l], r[l + 1]);
+    t[l + 1] = _mm256_unpackhi_epi32(r[l], r[l + 1]);
+  }
+  for (unsigned int l = 0; l < 8; l += 4) {
+    u[l] = _mm256_unpacklo_epi64(t[l], t[l + 2]);
+    u[l + 1] = _mm256_unpackhi_epi64(t[l], t[l + 2]);
+    u[l + 2] = _mm256_unpacklo_epi64(t[l + 1], t[l + 3]);
+    u[l + 3] = _mm256_unpackhi_epi64(t[l + 1], t[l + 3]);
+  }
+  for (unsigned int i = 0; i < 4; i++) {
+    w[i] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i + 4], 0x20),
+                               bswap);
+    w[i + 4] = _mm256_shuffle_epi8(
+        _mm256_permute2x128_si256(u[i], u[i + 4], 0x31), bswap);
+  }
+}
+
+// Defines a compression function for the given number of lanes that operates
+// on vectors of the given type. The operations are macros of the form
+// OPS_name(...), such that AVX2 and AVX-512 share the round structure.
+#define DEFINE_SHA256_COMPRESS_SIMD(name, target, type, lanes, OPS)            \
+  target static void name(uint32_t* states, const unsigned char* const* data, \
+                          size_t n_blocks) {                                   \
+    const unsigned char* blocks[(lanes)];                                      \
+    for (unsigned int l = 0; l < (lanes); l++) {                               \
+      blocks[l] = data[l];                                                     \
+    }                                                                          \
+    type s[8];                                                                 \
+    for (unsigned int i = 0; i < 8; i++) {                                     \
+      s[i] = OPS##_LOAD(states + i * (lanes));                                 \
+    }                                                                          \
+    for (size_t i = 0; i < n_blocks; i++) {                                    \
+      type w[16];                                                              \
+      OPS##_LOAD_WORDS(w, blocks);                                             \
+      type a = s[0], b = s[1], c = s[2], d = s[3];                             \
+      type e = s[4], f = s[5], g = s[6], h = s[7];                             \
+      for (unsigned int t = 0; t < 64; t++) {                                  \
+        if (t >= 16) {                                                         \
+          const type w15 = w[(t - 15) % 16], w2 = w[(t - 2) % 16];             \
+          const type s0 = OPS##_XOR3(OPS##_ROR(w15, 7), OPS##_ROR(w15, 18),    \
+                                     OPS##_SHR(w15, 3));                       \
+          const type s1 = OPS##_XOR3(OPS##_ROR(w2, 17), OPS##_ROR(w2, 19),     \
+                                     OPS##_SHR(w2, 10));                       \
+          w[t % 16] = OPS##_ADD(OPS##_ADD(w[t % 16], s0),                      \
+                                OPS##_ADD(w[(t - 7) % 16], s1));               \
+        }                                                                      \
+        const type s1 = OPS##_XOR3(OPS##_ROR(e, 6), OPS##_ROR(e, 11),          \
+                                   OPS##_ROR(e, 25));                          \
+        const type t1 = OPS##_ADD(                                             \
+            OPS##_ADD(h, s1),                                                  \
+            OPS##_ADD(OPS##_CH(e, f, g),                                       \
+                      OPS##_ADD(OPS##_SET1(sha256_k[t]), w[t % 16])));         \
+        const type s0 = OPS##_XOR3(OPS##_ROR(a, 2), OPS##_ROR(a, 13),          \
+                                   OPS##_ROR(a, 22));                          \
+        const type t2 = OPS##_ADD(s0, OPS##_MAJ(a, b, c));                     \
+        h = g;                                                                 \
+        g = f;                                                                 \
+        f = e;                                                                 \
+        e = OPS##_ADD(d, t1);                                                  \
+        d = c;                                                                 \
+        c = b;                                                                 \
+        b = a;                                                                 \
+        a = OPS##_ADD(t1, t2);                                                 \
+      }                                                                        \
+      s[0] = OPS##_ADD(s[0], a);                                               \
+      s[1] = OPS##_ADD(s[1], b);                                               \
+      s[2] = OPS##_ADD(s[2], c);                                               \
+      s[3] = OPS##_ADD(s[3], d);                                               \
+      s[4] = OPS##_ADD(s[4], e);                                               \
+      s[5] = OPS##_ADD(s[5], f);                                               \
+      s[6] = OPS##_ADD(s[6], g);                                               \
+      s[7] = OPS##_ADD(s[7], h);                                               \
+      for (unsigned int l = 0; l < (lanes); l++) {                             \
+        blocks[l] += SHA256_BLOCK_SIZE;                                        \
+      }                                                                        \
+    }                                                                          \
+    for (unsigned int i = 0; i < 8; i++) {                                     \
+      OPS##_STORE(states + i * (lanes), s[i]);                                 \
+    }                                                                          \
+  }
+
+#define AVX2_LOAD(p) _mm256_loadu_si256((const __m256i*) (p))
+#define AVX2_STORE(p, x) _mm256_storeu_si256((__m256i*) (p), (x))
+#define AVX2_SET1(x) _mm256_set1_epi32((int) (x))
+#define AVX2_ADD(x, y) _mm256_add_epi32((x), (y))
+#define AVX2_SHR(x, n) _mm256_srli_epi32((x), (n))
+#define AVX2_ROR(x, n)                                                         \
+  _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define AVX2_XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+#define AVX2_CH(e, f, g)                                                       \
+  _mm256_xor_si256(_mm256_and_si256((e), (f)), _mm256_andnot_si256((e), (g)))
+#define AVX2_MAJ(a, b, c)                                                      \
+  _mm256_or_si256(_mm256_and_si256((a), (b)),                                  \
+                  _mm256_and_si256((c), _mm256_or_si256((a), (b))))
+#define AVX2_LOAD_WORDS(w, blocks)                                             \
+  do {                                                                         \
+    load_words_x8((w), (blocks), 0);                                           \
+    load_words_x8((w) + 8, (blocks), 1);                                       \
+  } while (0)
+
+DEFINE_SHA256_COMPRESS_SIMD(compress_avx2, AVX2_TARGET, __m256i, 8, AVX2)
+
+static int avx2_supported(void) {
+  return __builtin_cpu_supports("avx2");
+}
+
+static const sha256_kernels sha256_kernels_avx2 = {
+  .name = "avx2",
+  .is_supported = avx2_supported,
+  .lanes = 8,
+  .cost = 11,
+  .compress = compress_avx2,
+};
+
+// Loads the words of the blocks of sixteen lanes as two groups of eight.
+AVX512_TARGET static inline void load_words_x16(
+    __m512i* w, const unsigned char* const* blocks) {
+  for (unsigned int half = 0; half < 2; half++) {
+    __m256i lo[8], hi[8];
+    load_words_x8(lo, blocks, half);
+    load_words_x8(hi, blocks + 8, half);
+    for (unsigned int i = 0; i < 8; i++) {
+      w[8 * half + i] =
+          _mm512_inserti64x4(_mm512_castsi256_si512(lo[i]), hi[i], 1);
+    }
+  }
+}
+
+#define AVX512_LOAD(p) _mm512_loadu_si512((const void*) (p))
+#define AVX512_STORE(p, x) _mm512_storeu_si512((void*) (p), (x))
+#define AVX512_SET1(x) _mm512_set1_epi32((int) (x))
+#define AVX512_ADD(x, y) _mm512_add_epi32((x), (y))
+#define AVX512_SHR(x, n) _mm512_srli_epi32((x), (n))
+#define AVX512_ROR(x, n) _mm512_ror_epi32((x), (n))
+#define AVX512_XOR3(x, y, z) _mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+#define AVX512_CH(e, f, g) _mm512_ternarylogic_epi32((e), (f), (g), 0xca)
+#define AVX512_MAJ(a, b, c) _mm512_ternarylogic_epi32((a), (b), (c), 0xe8)
+#define AVX512_LOAD_WORDS(w, blocks) load_words_x16((w), (blocks))
+
+DEFINE_SHA256_COMPRESS_SIMD(compress_avx512, AVX512_TARGET, __m512i, 16,
+                            AVX512)
+
+static int avx512_supported(void) {
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("avx512f");
+}
+
+static const sha256_kernels sha256_kernels_avx512 = {
+  .name = "avx512",
+  .is_supported = avx512_supported,
+  .lanes = 16,
+  .cost = 11,
+  .compress = compress_avx512,
+};
+
+#endif  // HAVE_X86_SHA256_KERNELS
+
+const sha256_kernels* const all_sha256_kernels[] = {
+#ifdef HAVE_X86_SHA256_KERNELS
+  &sha256_kernels_avx512,
+  &sha256_kernels_shani,
+  &sha256_kernels_avx2,
+#endif
+  &sha256_kernels_scalar,
+  NULL,
+};
+
+static void init_states(uint32_t* states, unsigned int lanes) {
+  for (unsigned int i = 0; i < 8; i++) {
+    for (unsigned int l = 0; l < lanes; l++) {
+      states[i * lanes + l] = sha256_iv[i];
+    }
+  }
+}
+
+// Writes the padding of messages of total_size bytes, whose last data_size
+// bytes are copied into the tails of the lanes, which lie stride bytes apart,
+// and returns the number of blocks that each padded tail occupies.
+static size_t pad_tails(unsigned char* tails, size_t stride, size_t data_size,
+                        size_t total_size) {
+  const size_t rest = data_size % SHA256_BLOCK_SIZE;
+  const size_t n_blocks = rest + 9 > SHA256_BLOCK_SIZE ? 2 : 1;
+  const size_t end = n_blocks * SHA256_BLOCK_SIZE;
+  const uint64_t bits = (uint64_t) total_size * 8;
+  for (unsigned int l = 0; l < MAX_SHA256_LANES; l++) {
+    unsigned char* tail = tails + l * stride;
+    memset(tail, 0, end - 8);
+    tail[rest] = 0x80;
+    store_be32(tail + end - 8, (uint32_t) (bits >> 32));
+    store_be32(tail + end - 4, (uint32_t) bits);
+  }
+  return n_blocks;
+}
+
+void init_commitment_engine(commitment_engine* engine,
+                            const commitment_scheme* scheme) {
+  engine->scheme = scheme;
+  engine->padded_size = (size_t) -1;
+  engine->n_tail_blocks = 0;
+  for (unsigned int l = 0; l < MAX_SHA256_LANES; l++) {
+    memset(engine->heads[l], 0x36, SHA256_BLOCK_SIZE);
+    memset(engine->outer_heads[l], 0x5c, SHA256_BLOCK_SIZE);
+  }
+  pad_tails(engine->outer_tails[0], sizeof(engine->outer_tails[0]),
+            COMMITMENT_SIZE, SHA256_BLOCK_SIZE + COMMITMENT_SIZE);
+}
+
+// Points unused lanes at the first message.
+static void fill_lanes(const unsigned char** dst,
+                       const unsigned char* const* src, size_t offset,
+                       unsigned int n, unsigned int lanes) {
+  for (unsigned int l = 0; l < lanes; l++) {
+    dst[l] = src[l < n ? l : 0] + offset;
+  }
+}
+
+// Compresses the data_size bytes at data[l] in each lane, which end the
+// messages whose padding the tails of the engine hold. The states must have
+// consumed whole blocks before.
+static void finish_lanes(commitment_engine* engine,
+                         const sha256_kernels* kernels, uint32_t* states,
+                         const unsigned char* const* data, size_t data_size) {
+  const unsigned int lanes = kernels->lanes;
+  const unsigned char* blocks[MAX_SHA256_LANES] = { NULL };
+  const size_t n_full_blocks = data_size / SHA256_BLOCK_SIZE;
+  const size_t rest = data_size % SHA256_BLOCK_SIZE;
+  if (n_full_blocks != 0) {
+    kernels->compress(states, data, n_full_blocks);
+  }
+  for (unsigned int l = 0; l < lanes; l++) {
+    memcpy(engine->tails[l], data[l] + data_size - rest, rest);
+    blocks[l] = engine->tails[l];
+  }
+  kernels->compress(states, blocks, engine->n_tail_blocks);
+}
+
+static void store_digest(unsigned char* out, const uint32_t* states,
+                         unsigned int lanes, unsigned int l) {
+  for (unsigned int i = 0; i < 8; i++) {
+    store_be32(out + 4 * i, states[i * lanes + l]);
+  }
+}
+
+// Computes HMAC-SHA256 of n messages in a single pass of the kernels. The
+// second halves of the padded keys and the padding of the inner digests never
+// change, so that only the keys and the ends of the messages are copied.
+static void hmac_sha256_lanes(commitment_engine* engine,
+                              const sha256_kernels* kernels,
+                              const unsigned char* const* keys,
+                              const unsigned char* const* data,
+                              size_t data_size, unsigned int n,
+                              unsigned char* out) {
+  const unsigned int lanes = kernels->lanes;
+  uint32_t inner[8 * MAX_SHA256_LANES], outer[8 * MAX_SHA256_LANES];
+  const unsigned char* blocks[MAX_SHA256_LANES] = { NULL };
+  if (engine->padded_size != data_size) {
+    engine->n_tail_blocks =
+        pad_tails(engine->tails[0], sizeof(engine->tails[0]), data_size,
+                  SHA256_BLOCK_SIZE + data_size);
+    engine->padded_size = data_size;
+  }
+
+  // The inner hash covers the key padded with ipad, followed by the message.
+  for (unsigned int l = 0; l < lanes; l++) {
+    const unsigned char* key = keys[l < n ? l : 0];
+    for (unsigned int i = 0; i < COMMITMENT_SIZE; i++) {
+      engine->heads[l][i] = key[i] ^ 0x36;
+      engine->outer_heads[l][i] = key[i] ^ 0x5c;
+    }
+    blocks[l] = engine->heads[l];
+  }
+  init_states(inner, lanes);
+  kernels->compress(inner, blocks, 1);
+  fill_lanes(blocks, data, 0, n, lanes);
+  finish_lanes(engine, kernels, inner, blocks, data_size);
+
+  // The outer hash covers the key padded with opad, followed by the inner hash.
+  for (unsigned int l = 0; l < lanes; l++) {
+    store_digest(engine->outer_tails[l], inner, lanes, l);
+    blocks[l] = engine->outer_heads[l];
+  }
+  init_states(outer, lanes);
+  kernels->compress(outer, blocks, 1);
+  for (unsigned int l = 0; l < lanes; l++) {
+    blocks[l] = engine->outer_tails[l];
+  }
+  kernels->compress(outer, blocks, 1);
+  for (unsigned int l = 0; l < n; l++) {
+    store_digest(out + l * COMMITMENT_SIZE, outer, lanes, l);
+  }
+}
+
+// Computes SHA-256(key || message) of n messages in a single pass of the
+// kernels. The first block holds the key and the beginning of the message,
+// which saves the three additional compressions of HMAC.
+static void sha256_lanes(commitment_engine* engine,
+                         const sha256_kernels* kernels,
+                         const unsigned char* const* keys,
+                         const unsigned char* const* data, size_t data_size,
+                         unsigned int n, unsigned char* out) {
+  const unsigned int lanes = kernels->lanes;
+  const size_t head_room = SHA256_BLOCK_SIZE - COMMITMENT_SIZE;
+  uint32_t states[8 * MAX_SHA256_LANES];
+  const unsigned char* blocks[MAX_SHA256_LANES] = { NULL };
+  init_states(states, lanes);
+
+  if (data_size >= head_room) {
+    if (engine->padded_size != data_size) {
+      engine->n_tail_blocks =
+          pad_tails(engine->tails[0], sizeof(engine->tails[0]),
+                    data_size - head_room, COMMITMENT_SIZE + data_size);
+      engine->padded_size = data_size;
+    }
+    for (unsigned int l = 0; l < lanes; l++) {
+      memcpy(engine->heads[l], keys[l < n ? l : 0], COMMITMENT_SIZE);
+      memcpy(engine->heads[l] + COMMITMENT_SIZE, data[l < n ? l : 0],
+             head_room);
+      blocks[l] = engine->heads[l];
+    }
+    kernels->compress(states, blocks, 1);
+    fill_lanes(blocks, data, head_room, n, lanes);
+    finish_lanes(engine, kernels, states, blocks, data_size - head_room);
+  } else {
+    // The whole message fits into the padded tail, next to the key.
+    if (engine->padded_size != data_size) {
+      engine->n_tail_blocks =
+          pad_tails(engine->tails[0], sizeof(engine->tails[0]),
+                    COMMITMENT_SIZE + data_size, COMMITMENT_SIZE + data_size);
+      engine->padded_size = data_size;
+    }
+    for (unsigned int l = 0; l < lanes; l++) {
+      memcpy(engine->tails[l], keys[l < n ? l : 0], COMMITMENT_SIZE);
+      memcpy(engine->tails[l] + COMMITMENT_SIZE, data[l < n ? l : 0],
+             data_size);
+      blocks[l] = engine->tails[l];
+    }
+    kernels->compress(states, blocks, engine->n_tail_blocks);
+  }
+  for (unsigned int l = 0; l < n; l++) {
+    store_digest(out + l * COMMITMENT_SIZE, states, lanes, l);
+  }
+}
+
+#if defined(__WASM__) && !defined(ZKP_BUILTIN_CRYPTO)
 
 __attribute__((import_module("crypto"), import_name("hmacSHA256"))) extern void
 hmac_sha256(const unsigned char* key, const unsigned char* data,
             size_t data_size, unsigned char* out);
 
+// The host computes HMAC-SHA256 faster than the portable kernels.
+static void host_hmac_sha256_lanes(commitment_engine* engine,
+                                   const sha256_kernels* kernels,
+                                   const unsigned char* const* keys,
+                                   const unsigned char* const* data,
+                                   size_t data_size, unsigned int n,
+                                   unsigned char* out) {
+  (void) engine;
+  (void) kernels;
+  for (unsigned int i = 0; i < n; i++) {
+    hmac_sha256(keys[i], data[i], data_size, out + i * COMMITMENT_SIZE);
+  }
+}
+
+#endif
+
+const commitment_scheme commitment_hmac_sha256 = {
+  .name = "HMAC-SHA256",
+#if defined(__WASM__) && !defined(ZKP_BUILTIN_CRYPTO)
+  .commit_lanes = host_hmac_sha256_lanes,
+#else
+  .commit_lanes = hmac_sha256_lanes,
+#endif
+};
+
+const commitment_scheme commitment_sha256 = {
+  .name = "SHA-256",
+  .commit_lanes = sha256_lanes,
+};
+
+void commit_with_kernels(commitment_engine* engine,
+                         const sha256_kernels* kernels,
+                         const unsigned char* const* keys,
+                         const unsigned char* const* data, size_t data_size,
+                         unsigned int n, unsigned char* out) {
+  while (n != 0) {
+    const unsigned int m = n < kernels->lanes ? n : kernels->lanes;
+    engine->scheme->commit_lanes(engine, kernels, keys, data, data_size, m,
+                                 out);
+    keys += m;
+    data += m;
+    out += m * COMMITMENT_SIZE;
+    n -= m;
+  }
+}
+
+// The supported kernels, in the order of all_sha256_kernels.
+static const sha256_kernels*
+    usable_sha256_kernels[sizeof(all_sha256_kernels) /
+                          sizeof(all_sha256_kernels[0])] = {
+      &sha256_kernels_scalar,
+    };
+static unsigned int n_usable_sha256_kernels = 1;
+
+#ifdef HAVE_X86_SHA256_KERNELS
+// Selecting the implementations before main() runs avoids synchronization.
+__attribute__((constructor)) static void select_sha256_kernels(void) {
+  __builtin_cpu_init();
+  n_usable_sha256_kernels = 0;
+  for (unsigned int i = 0; all_sha256_kernels[i] != NULL; i++) {
+    if (all_sha256_kernels[i]->is_supported()) {
+      usable_sha256_kernels[n_usable_sha256_kernels++] = all_sha256_kernels[i];
+    }
+  }
+}
 #endif
 
-void commit_hmac_sha256(const unsigned char* key, const unsigned char* data,
-                        size_t data_size, unsigned char* out) {
-  hmac_sha256(key, data, data_size, out);
+// Returns the kernels that process the next group of the n remaining messages
+// at the lowest cost per message. Ties are resolved by preference.
+static const sha256_kernels* select_kernels_for(unsigned int n) {
+  const sha256_kernels* best = usable_sha256_kernels[0];
+  for (unsigned int i = 1; i < n_usable_sha256_kernels; i++) {
+    const sha256_kernels* k = usable_sha256_kernels[i];
+    const unsigned int k_used = n < k->lanes ? n : k->lanes;
+    const unsigned int best_used = n < best->lanes ? n : best->lanes;
+    if (k->cost * best_used < best->cost * k_used) {
+      best = k;
+    }
+  }
+  return best;
+}
+
+void commit_batch(commitment_engine* engine, const unsigned char* const* keys,
+                  const unsigned char* const* data, size_t data_size,
+                  unsigned int n, unsigned char* out) {
+  while (n != 0) {
+    const sha256_kernels* kernels = select_kernels_for(n);
+    const unsigned int m = n < kernels->lanes ? n : kernels->lanes;
+    engine->scheme->commit_lanes(engine, kernels, keys, data, data_size, m,
+                                 out);
+    keys += m;
+    data += m;
+    out += m * COMMITMENT_SIZE;
+    n -= m;
+  }
 }
@@ -1,6 +1,89 @@
+#include <stdint.h>
 #include <stdlib.h>
 
 #define COMMITMENT_SIZE 32
 
-void commit_hmac_sha256(const unsigned char* key, const unsigned char* data,
-                        size_t data_size, unsigned char* out);
+#define SHA256_BLOCK_SIZE 64
+
+// The largest number of lanes of any sha256_kernels.
+#define MAX_SHA256_LANES 16
+
+// Kernels that apply the SHA-256 compression function to the independent
+// states of several messages at once, one message per lane. Word w of the
+// state of lane l is states[w * lanes + l], and lane l consumes n_blocks
+// consecutive blocks that start at data[l].
+typedef struct {
+  const char* name;
+  int (*is_supported)(void);
+  unsigned int lanes;
+  // The approximate time of one call of compress per block, relative to the
+  // other kernels, which decides how many lanes are worth filling.
+  unsigned int cost;
+  void (*compress)(uint32_t* states, const unsigned char* const* data,
+                   size_t n_blocks);
+} sha256_kernels;
+
+// All implementations, ordered by preference and terminated by NULL. The last
+// implementation is the portable reference, which is always supported.
+extern const sha256_kernels* const all_sha256_kernels[];
+
+typedef struct commitment_engine_s commitment_engine;
+
+// A way to commit to messages with keys of COMMITMENT_SIZE bytes, which yields
+// commitments of COMMITMENT_SIZE bytes.
+typedef struct {
+  const char* name;
+  // Commits to data[i] with keys[i] for i = 0, ..., n - 1 in a single pass of
+  // the kernels, where n does not exceed their lanes, and stores the results
+  // one after another in out. Each message has data_size bytes.
+  void (*commit_lanes)(commitment_engine* engine,
+                       const sha256_kernels* kernels,
+                       const unsigned char* const* keys,
+                       const unsigned char* const* data, size_t data_size,
+                       unsigned int n, unsigned char* out);
+} commitment_scheme;
+
+// HMAC-SHA256(key, message).
+extern const commitment_scheme commitment_hmac_sha256;
+
+// SHA-256(key || message). For an m-byte message it needs ceil((m + 41) / 64)
+// compressions, while HMAC needs 3 + ceil((m + 9) / 64), which is three more
+// if m % 64 is below 24 or at least 56, and two more otherwise.
+// Since the key has a fixed size, the length extension of SHA-256 only yields
+// commitments to longer messages, which the protocol never accepts.
+extern const commitment_scheme commitment_sha256;
+
+// The padded blocks of all lanes of a commitment scheme, which are reused by
+// consecutive calls. Only the keys and the ends of the messages are copied
+// into them, while the padding is written once per message size. Each proof
+// and verification owns an engine, so that commitments require neither
+// allocations nor synchronization.
+struct commitment_engine_s {
+  const commitment_scheme* scheme;
+  // The message size that the padding in tails belongs to, and the number of
+  // blocks of each padded tail.
+  size_t padded_size;
+  size_t n_tail_blocks;
+  unsigned char heads[MAX_SHA256_LANES][SHA256_BLOCK_SIZE];
+  unsigned char tails[MAX_SHA256_LANES][2 * SHA256_BLOCK_SIZE];
+  // The outer hash of HMAC, whose second block is always a digest.
+  unsigned char outer_heads[MAX_SHA256_LANES][SHA256_BLOCK_SIZE];
+  unsigned char outer_tails[MAX_SHA256_LANES][SHA256_BLOCK_SIZE];
+};
+
+void init_commitment_engine(commitment_engine* engine,
+                            const commitment_scheme* scheme);
+
+// Commits to any number of messages using the given kernels.
+void commit_with_kernels(commitment_engine* engine,
+                         const sha256_kernels* kernels,
+                         const unsigned char* const* keys,
+                         const unsigned char* const* data, size_t data_size,
+                         unsigned int n, unsigned char* out);
+
+// Commits to any number of messages. Groups of messages are processed by the
+// supported kernels with the lowest cost per message, which run several lanes
+// in parallel if enough messages remain.
+void commit_batch(commitment_engine* engine, const unsigned char* const* keys,
+                  const unsigned char* const* data, size_t data_size,
+                  unsigned int n, unsigned char* out);
@@ -1,146 +1,584 @@
 #include <assert.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <zkp-volte-patarin-nachef/protocol.h>
 
+#ifndef __WASM__
+#include <pthread.h>
+#endif
+
+#include "commitment.h"
+#include "kernels.h"
 #include "random.h"
 
+// Points are zero-based. Each image is stored as the one-based label that is
+// used by the portable representation, which makes the in-memory layout of a
+// small permutation identical to its encoding.
 typedef struct {
-  unsigned int* mapping;
+  union {
+    uint8_t* small;
+    uint16_t* large;
+  } mapping;
   unsigned int domain;
 } permutation;
 
+// Describes the permutations H[k] = h^k, or F[k] = H[k]^-1 * f * H[k] if f is
+// not NULL, by the cycles of h, such that each of them can be computed in
+// linear time instead of being stored.
+typedef struct {
+  // The points of each cycle as one-based labels, one cycle after another,
+  // such that h maps each point to the next one within its cycle.
+  const uint16_t* cycles;
+  const uint16_t* cycle_lengths;
+  unsigned int n_cycles;
+  const permutation* f;
+} implicit_permutation_array;
+
+// Permutations in an array are stored one after another, using the same
+// representation as permutation. Each permutation starts at a cache line
+// boundary, such that reading one touches as few cache lines as possible.
+//
+// If implicit is not NULL, the array has no storage, and its permutations are
+// computed on demand instead, see load_permutation_from_array.
 typedef struct {
-  const uint16_t* base;
+  union {
+    const uint8_t* small;
+    const uint16_t* large;
+  } base;
   unsigned int domain;
   unsigned int count;
+  const implicit_permutation_array* implicit;
+  // Optional hash table for reverse lookups, see index_permutation_array. Each
+  // slot holds a one-based index into the array, or zero if it is empty.
+  const uint32_t* index;
+  uint32_t index_mask;
 } permutation_array;
 
+#define CACHE_LINE_SIZE 64
+
+#ifdef __GNUC__
+#define CACHE_ALIGNED __attribute__((aligned(CACHE_LINE_SIZE)))
+#else
+#define CACHE_ALIGNED
+#endif
+
+#define PERMUTATION_IS_SMALL(perm) ((perm)->domain <= MAX_DOMAIN_SMALL_REPR)
+
+#define PERMUTATION_ELEMENT_SIZE(domain)                                       \
+  ((domain) > MAX_DOMAIN_SMALL_REPR ? sizeof(uint16_t) : sizeof(uint8_t))
+
+// The distance between consecutive permutations of a permutation_array, in
+// elements. This is a constant expression if domain is.
+#define PERMUTATION_ARRAY_STRIDE(domain)                                       \
+  (((domain) * PERMUTATION_ELEMENT_SIZE(domain) + CACHE_LINE_SIZE - 1) /       \
+   CACHE_LINE_SIZE * CACHE_LINE_SIZE / PERMUTATION_ELEMENT_SIZE(domain))
+
 #define STACK_ALLOC_PERMUTATION(name, domain_n)                                \
   permutation name = { .domain = (domain_n) };                                 \
-  unsigned int __perm_##name##__mapping[name.domain];                          \
+  uint16_t __perm_##name##__mapping[name.domain];                              \
   do {                                                                         \
-    name.mapping = __perm_##name##__mapping;                                   \
+    name.mapping.large = __perm_##name##__mapping;                             \
   } while (0)
 
 #define PERMUTATION_SET(perm, index, value)                                    \
   do {                                                                         \
-    (perm)->mapping[((index)) - 1] = value;                                    \
+    if (PERMUTATION_IS_SMALL(perm)) {                                          \
+      (perm)->mapping.small[(index)] = (uint8_t) ((value) + 1);                \
+    } else {                                                                   \
+      (perm)->mapping.large[(index)] = (uint16_t) ((value) + 1);               \
+    }                                                                          \
   } while (0)
 
-#define PERMUTATION_GET(perm, index) ((perm)->mapping[((index)) - 1])
+#define PERMUTATION_GET(perm, index)                                           \
+  ((unsigned int) (PERMUTATION_IS_SMALL(perm)                                  \
+                       ? (perm)->mapping.small[(index)]                        \
+                       : (perm)->mapping.large[(index)]) -                     \
+   1)
 
-#define PERMUTATION_ARRAY_GET(perm_array, perm_index, index)                   \
-  ((perm_array)->base[(perm_array)->count * (((index)) - 1) + (perm_index)])
+static inline size_t permutation_mapping_size(unsigned int domain) {
+  return domain * PERMUTATION_ELEMENT_SIZE(domain);
+}
 
-#define PERMUTATION_ARRAY_BASE_SET(perm_array, base, perm_index, index, value) \
-  do {                                                                         \
-    ((base)[(perm_array)->count * (((index)) - 1) + (perm_index)]) = (value);  \
-  } while (0)
+static inline const void* permutation_mapping_bytes(const permutation* perm) {
+  return PERMUTATION_IS_SMALL(perm) ? (const void*) perm->mapping.small
+                                    : (const void*) perm->mapping.large;
+}
+
+static inline int alloc_permutation(permutation* perm, unsigned int domain) {
+  perm->domain = domain;
+  if (PERMUTATION_IS_SMALL(perm)) {
+    perm->mapping.small = malloc(permutation_mapping_size(domain));
+    return perm->mapping.small != NULL;
+  }
+  perm->mapping.large = malloc(permutation_mapping_size(domain));
+  return perm->mapping.large != NULL;
+}
+
+static inline void free_permutation(const permutation* perm) {
+  if (PERMUTATION_IS_SMALL(perm)) {
+    free(perm->mapping.small);
+  } else {
+    free(perm->mapping.large);
+  }
+}
+
+// Overwrites the mapping with zeros before it is freed, for permutations that
+// reveal the private key.
+static inline void wipe_permutation(const permutation* perm) {
+  if (PERMUTATION_IS_SMALL(perm)) {
+    memset(perm->mapping.small, 0, permutation_mapping_size(perm->domain));
+  } else {
+    memset(perm->mapping.large, 0, permutation_mapping_size(perm->domain));
+  }
+}
 
 static inline void identity_permutation(permutation* perm) {
-  for (unsigned int i = 1; i <= perm->domain; i++) {
-    PERMUTATION_SET(perm, i, i);
+  const unsigned int n = perm->domain;
+  if (PERMUTATION_IS_SMALL(perm)) {
+    uint8_t* m = perm->mapping.small;
+    for (unsigned int i = 0; i < n; i++) {
+      m[i] = (uint8_t) (i + 1);
+    }
+  } else {
+    uint16_t* m = perm->mapping.large;
+    for (unsigned int i = 0; i < n; i++) {
+      m[i] = (uint16_t) (i + 1);
+    }
   }
 }
 
-static inline int is_permutation(permutation* perm) {
-  for (unsigned int i = 1; i <= perm->domain; i++) {
+// Checks in linear time that the mapping is a bijection on the domain, using a
+// bitmap of the images that have been seen already.
+static inline int is_permutation(const permutation* perm) {
+  const unsigned int n = perm->domain;
+  uint64_t seen[(n + 63) / 64];
+  memset(seen, 0, sizeof(seen));
+  for (unsigned int i = 0; i < n; i++) {
     unsigned int v = PERMUTATION_GET(perm, i);
-    // The codomain must be { 1, 2, ..., n }.
-    if (v < 1 || v > perm->domain) {
+    // The codomain must be { 0, 1, ..., n - 1 }. Note that a stored label of
+    // zero wraps around and is rejected here as well.
+    if (v >= n) {
       return 0;
     }
     // The mapping must be injective (which implies bijective).
-    for (unsigned int j = 1; j < i; j++) {
-      if (v == PERMUTATION_GET(perm, j)) {
-        return 0;
-      }
+    const uint64_t bit = UINT64_C(1) << (v % 64);
+    if (seen[v / 64] & bit) {
+      return 0;
     }
+    seen[v / 64] |= bit;
   }
   return 1;
 }
 
 static inline void copy_permutation_into(permutation* dst,
                                          const permutation* src) {
-  // TODO: ensure that both permutations have the same domain
-  for (unsigned int i = 0; i < src->domain; i++) {
-    dst->mapping[i] = src->mapping[i];
+  assert(dst->domain == src->domain);
+  if (PERMUTATION_IS_SMALL(src)) {
+    memcpy(dst->mapping.small, src->mapping.small,
+           permutation_mapping_size(src->domain));
+  } else {
+    memcpy(dst->mapping.large, src->mapping.large,
+           permutation_mapping_size(src->domain));
   }
 }
 
-static inline void inverse_of_permutation(permutation* p) {
-  STACK_ALLOC_PERMUTATION(t, p->domain);
-  for (unsigned int i = 1; i <= t.domain; i++) {
-    PERMUTATION_SET(&t, PERMUTATION_GET(p, i), i);
+// Returns the number of bytes to allocate for an array of count permutations
+// on the given domain, including the slack for aligning it to a cache line.
+static inline size_t permutation_array_alloc_size(unsigned int domain,
+                                                  unsigned int count) {
+  return (size_t) count * PERMUTATION_ARRAY_STRIDE(domain) *
+             PERMUTATION_ELEMENT_SIZE(domain) +
+         CACHE_LINE_SIZE - 1;
+}
+
+// Returns the first address within storage that is aligned to a cache line.
+static inline void* align_to_cache_line(void* storage) {
+  unsigned char* p = storage;
+  return p + (CACHE_LINE_SIZE - (uintptr_t) p % CACHE_LINE_SIZE) %
+                 CACHE_LINE_SIZE;
+}
+
+// Allocates the storage for an array of count permutations on the given
+// domain, aligned to a cache line. The storage is never freed.
+static inline void* alloc_permutation_array_base(unsigned int domain,
+                                                 unsigned int count) {
+  void* storage = malloc(permutation_array_alloc_size(domain, count));
+  if (storage == NULL) {
+    return NULL;
   }
-  copy_permutation_into(p, &t);
+  return align_to_cache_line(storage);
 }
 
-static inline void multiply_permutation(permutation* p, const permutation* f) {
-  assert(p->domain != 0 && p->domain == f->domain);
-  STACK_ALLOC_PERMUTATION(t, p->domain);
-  for (unsigned int i = 1; i <= t.domain; i++) {
-    PERMUTATION_SET(&t, i, PERMUTATION_GET(f, PERMUTATION_GET(p, i)));
+// Returns the permutation at the given index of an array that is not implicit,
+// without copying it. The returned permutation must not be modified unless the
+// array is writable.
+static inline permutation permutation_array_element(
+    const permutation_array* array, unsigned int perm_index) {
+  assert(array->implicit == NULL && perm_index < array->count);
+  const size_t offset =
+      (size_t) perm_index * PERMUTATION_ARRAY_STRIDE(array->domain);
+  permutation perm = { .domain = array->domain };
+  if (PERMUTATION_IS_SMALL(array)) {
+    perm.mapping.small = (uint8_t*) (array->base.small + offset);
+  } else {
+    perm.mapping.large = (uint16_t*) (array->base.large + offset);
   }
-  copy_permutation_into(p, &t);
+  return perm;
 }
 
-static inline void multiply_permutation_from_array(permutation* p,
-                                                   const permutation_array* f,
-                                                   unsigned int perm_index) {
-  // TODO: ensure domain is the same
-  STACK_ALLOC_PERMUTATION(t, p->domain);
-  for (unsigned int i = 1; i <= t.domain; i++) {
-    PERMUTATION_SET(
-        &t, i, PERMUTATION_ARRAY_GET(f, perm_index, PERMUTATION_GET(p, i)));
+#define PERMUTATION_ARRAY_GET(perm_array, perm_index, index)                   \
+  ((unsigned int) (PERMUTATION_IS_SMALL(perm_array)                            \
+                       ? (perm_array)->base.small                              \
+                             [(size_t) (perm_index) *                          \
+                                  PERMUTATION_ARRAY_STRIDE(                    \
+                                      (perm_array)->domain) +                  \
+                              (index)]                                         \
+                       : (perm_array)->base.large                              \
+                             [(size_t) (perm_index) *                          \
+                                  PERMUTATION_ARRAY_STRIDE(                    \
+                                      (perm_array)->domain) +                  \
+                              (index)]) -                                      \
+   1)
+
+// Computes the one-based labels of H[k] = h^k for an implicit array, which maps
+// the j-th point of each cycle of h to the (j + k)-th point of the same cycle.
+static inline void compute_implicit_power(uint16_t* dst,
+                                          const implicit_permutation_array* a,
+                                          unsigned int k) {
+  const uint16_t* c = a->cycles;
+  for (unsigned int i = 0; i < a->n_cycles; i++) {
+    const unsigned int len = a->cycle_lengths[i];
+    const unsigned int r = k % len;
+    for (unsigned int j = 0; j < len - r; j++) {
+      dst[c[j] - 1] = c[j + r];
+    }
+    for (unsigned int j = len - r; j < len; j++) {
+      dst[c[j] - 1] = c[j + r - len];
+    }
+    c += len;
   }
-  copy_permutation_into(p, &t);
+}
+
+// Computes the mapping of the permutation at the given index of an implicit
+// array with n points into buf, and returns buf.
+static inline const uint8_t* compute_permutation_row_small(
+    const permutation_array* array, unsigned int perm_index, unsigned int n,
+    uint8_t* buf) {
+  assert(array->implicit != NULL && perm_index < array->count);
+  uint16_t h[n];
+  compute_implicit_power(h, array->implicit, perm_index);
+  if (array->implicit->f == NULL) {
+    for (unsigned int x = 0; x < n; x++) {
+      buf[x] = (uint8_t) h[x];
+    }
+  } else {
+    // (h^-k * f * h^k)(h^k(y)) = h^k(f(y)).
+    const uint8_t* f = array->implicit->f->mapping.small;
+    for (unsigned int y = 0; y < n; y++) {
+      buf[h[y] - 1] = (uint8_t) h[f[y] - 1];
+    }
+  }
+  return buf;
+}
+
+static inline const uint16_t* compute_permutation_row_large(
+    const permutation_array* array, unsigned int perm_index, unsigned int n,
+    uint16_t* buf) {
+  assert(array->implicit != NULL && perm_index < array->count);
+  uint16_t h[n];
+  compute_implicit_power(h, array->implicit, perm_index);
+  if (array->implicit->f == NULL) {
+    memcpy(buf, h, sizeof(h));
+  } else {
+    const uint16_t* f = array->implicit->f->mapping.large;
+    for (unsigned int y = 0; y < n; y++) {
+      buf[h[y] - 1] = h[f[y] - 1];
+    }
+  }
+  return buf;
+}
+
+// Computes the permutation at the given index of an implicit array.
+static inline void compute_permutation_in_array(permutation* dst,
+                                                const permutation_array* array,
+                                                unsigned int perm_index) {
+  assert(dst->domain == array->domain);
+  if (PERMUTATION_IS_SMALL(dst)) {
+    compute_permutation_row_small(array, perm_index, dst->domain,
+                                  dst->mapping.small);
+  } else {
+    compute_permutation_row_large(array, perm_index, dst->domain,
+                                  dst->mapping.large);
+  }
+}
+
+// Returns the permutation at the given index of the array. For an implicit
+// array, the permutation is computed into buf, which must not be modified while
+// the result is in use. Otherwise, the result is a view as returned by
+// permutation_array_element.
+static inline permutation load_permutation_from_array(
+    const permutation_array* array, unsigned int perm_index, permutation* buf) {
+  if (array->implicit != NULL) {
+    compute_permutation_in_array(buf, array, perm_index);
+    return *buf;
+  }
+  return permutation_array_element(array, perm_index);
 }
 
 static inline void copy_permutation_from_array(permutation* dst,
                                                const permutation_array* src,
                                                unsigned int perm_index) {
-  // TODO: ensure domain is the same
-  for (unsigned int i = 1; i <= dst->domain; i++) {
-    PERMUTATION_SET(dst, i, PERMUTATION_ARRAY_GET(src, perm_index, i));
+  if (src->implicit != NULL) {
+    compute_permutation_in_array(dst, src, perm_index);
+    return;
+  }
+  const permutation element = permutation_array_element(src, perm_index);
+  copy_permutation_into(dst, &element);
+}
+
+// Determines the cycles of h for an implicit_permutation_array, using storage
+// for up to h->domain points and cycles, including fixed points.
+static inline void init_implicit_permutation_array(
+    implicit_permutation_array* implicit, const permutation* h,
+    uint16_t* cycles, uint16_t* cycle_lengths, const permutation* f) {
+  unsigned char visited[h->domain];
+  memset(visited, 0, sizeof(visited));
+  unsigned int n_points = 0;
+  implicit->n_cycles = 0;
+  for (unsigned int x = 0; x < h->domain; x++) {
+    if (visited[x]) {
+      continue;
+    }
+    unsigned int len = 0;
+    for (unsigned int y = x; !visited[y]; y = PERMUTATION_GET(h, y)) {
+      visited[y] = 1;
+      cycles[n_points + len++] = (uint16_t) (y + 1);
+    }
+    cycle_lengths[implicit->n_cycles++] = (uint16_t) len;
+    n_points += len;
+  }
+  implicit->cycles = cycles;
+  implicit->cycle_lengths = cycle_lengths;
+  implicit->f = f;
+}
+
+// Stores src at the given index of an array whose storage is writable.
+static inline void store_permutation_in_array(const permutation_array* array,
+                                              unsigned int perm_index,
+                                              const permutation* src) {
+  permutation element = permutation_array_element(array, perm_index);
+  copy_permutation_into(&element, src);
+}
+
+// The following functions compute products out of place, that is, without
+// copying operands or intermediate results. The product a * b applies a first,
+// then b. Unless stated otherwise, dst may alias a but not b.
+
+// dst = a^-1. dst must not alias a.
+static inline void inverse_permutation_into(permutation* dst,
+                                            const permutation* a) {
+  assert(dst->domain == a->domain && dst != a);
+  if (PERMUTATION_IS_SMALL(a)) {
+    get_shuffle_kernels()->inverse(dst->mapping.small, a->mapping.small,
+                                   a->domain);
+  } else {
+    get_gather_kernels()->inverse(dst->mapping.large, a->mapping.large,
+                                  a->domain);
+  }
+}
+
+// dst = a * b.
+static inline void compose_permutations(permutation* dst, const permutation* a,
+                                        const permutation* b) {
+  assert(a->domain != 0 && dst->domain == a->domain && a->domain == b->domain);
+  if (PERMUTATION_IS_SMALL(a)) {
+    get_shuffle_kernels()->compose(dst->mapping.small, a->mapping.small,
+                                   b->mapping.small, a->domain);
+  } else {
+    get_gather_kernels()->compose(dst->mapping.large, a->mapping.large,
+                                  b->mapping.large, a->domain);
   }
 }
 
-static inline void store_permutation_interleaved(const permutation_array* array,
-                                                 uint16_t* base,
-                                                 unsigned int perm_index,
-                                                 const permutation* src) {
-  for (unsigned int i = 1; i <= src->domain; i++) {
-    PERMUTATION_ARRAY_BASE_SET(array, base, perm_index, i,
-                               PERMUTATION_GET(src, i));
+// dst = a * b^-1.
+static inline void compose_permutation_with_inverse(permutation* dst,
+                                                    const permutation* a,
+                                                    const permutation* b) {
+  assert(a->domain != 0 && dst->domain == a->domain && a->domain == b->domain);
+  if (PERMUTATION_IS_SMALL(a)) {
+    get_shuffle_kernels()->compose_inverse(
+        dst->mapping.small, a->mapping.small, b->mapping.small, a->domain);
+  } else {
+    get_gather_kernels()->compose_inverse(dst->mapping.large, a->mapping.large,
+                                          b->mapping.large, a->domain);
   }
 }
 
+// dst = a^-1 * b. dst must not alias a or b.
+static inline void compose_inverse_with_permutation(permutation* dst,
+                                                    const permutation* a,
+                                                    const permutation* b) {
+  assert(a->domain != 0 && dst->domain == a->domain && a->domain == b->domain);
+  assert(dst != a && dst != b);
+  if (PERMUTATION_IS_SMALL(a)) {
+    get_shuffle_kernels()->inverse_compose(
+        dst->mapping.small, a->mapping.small, b->mapping.small, a->domain);
+  } else {
+    get_gather_kernels()->inverse_compose(dst->mapping.large, a->mapping.large,
+                                          b->mapping.large, a->domain);
+  }
+}
+
+// dst = h^-1 * f * h. dst must not alias f or h.
+static inline void conjugate_permutation(permutation* dst, const permutation* f,
+                                         const permutation* h) {
+  assert(f->domain != 0 && dst->domain == f->domain && f->domain == h->domain);
+  assert(dst != f && dst != h);
+  if (PERMUTATION_IS_SMALL(f)) {
+    get_shuffle_kernels()->conjugate(dst->mapping.small, f->mapping.small,
+                                     h->mapping.small, f->domain);
+  } else {
+    get_gather_kernels()->conjugate(dst->mapping.large, f->mapping.large,
+                                    h->mapping.large, f->domain);
+  }
+}
+
+// dst = a * b[perm_index].
+static inline void compose_permutation_with_array(permutation* dst,
+                                                  const permutation* a,
+                                                  const permutation_array* b,
+                                                  unsigned int perm_index) {
+  STACK_ALLOC_PERMUTATION(buf, b->domain);
+  const permutation t = load_permutation_from_array(b, perm_index, &buf);
+  compose_permutations(dst, a, &t);
+}
+
+// dst = a * b[perm_index]^-1.
+static inline void compose_permutation_with_array_inverse(
+    permutation* dst, const permutation* a, const permutation_array* b,
+    unsigned int perm_index) {
+  STACK_ALLOC_PERMUTATION(buf, b->domain);
+  const permutation t = load_permutation_from_array(b, perm_index, &buf);
+  compose_permutation_with_inverse(dst, a, &t);
+}
+
+// dst = h[h_index]^-1 * f * h[h_index]. dst must not alias f.
+static inline void conjugate_permutation_by_array(permutation* dst,
+                                                  const permutation* f,
+                                                  const permutation_array* h,
+                                                  unsigned int h_index) {
+  STACK_ALLOC_PERMUTATION(buf, h->domain);
+  const permutation t = load_permutation_from_array(h, h_index, &buf);
+  conjugate_permutation(dst, f, &t);
+}
+
+// dst = h[h_index]^-1 * f[f_index] * h[h_index].
+static inline void conjugate_array_element(permutation* dst,
+                                           const permutation_array* f,
+                                           unsigned int f_index,
+                                           const permutation_array* h,
+                                           unsigned int h_index) {
+  STACK_ALLOC_PERMUTATION(buf, f->domain);
+  const permutation t = load_permutation_from_array(f, f_index, &buf);
+  conjugate_permutation_by_array(dst, &t, h, h_index);
+}
+
+static inline void inverse_of_permutation(permutation* p) {
+  STACK_ALLOC_PERMUTATION(t, p->domain);
+  inverse_permutation_into(&t, p);
+  copy_permutation_into(p, &t);
+}
+
+static inline void multiply_permutation(permutation* p, const permutation* f) {
+  compose_permutations(p, p, f);
+}
+
+static inline void multiply_permutation_from_array(permutation* p,
+                                                   const permutation_array* f,
+                                                   unsigned int perm_index) {
+  compose_permutation_with_array(p, p, f, perm_index);
+}
+
 static inline void multiply_permutation_from_array_inv(
     permutation* p, const permutation_array* f, unsigned int perm_index) {
-  // TODO: ensure domain is the same
-  // TODO: it should be possible to make this more efficient (without extracting
-  // the permutation from the array first)
-  STACK_ALLOC_PERMUTATION(t, p->domain);
-  copy_permutation_from_array(&t, f, perm_index);
-  inverse_of_permutation(&t);
-  multiply_permutation(p, &t);
+  compose_permutation_with_array_inverse(p, p, f, perm_index);
+}
+
+static inline uint32_t hash_permutation(const permutation* perm) {
+  const unsigned char* bytes = permutation_mapping_bytes(perm);
+  const size_t size = permutation_mapping_size(perm->domain);
+  uint64_t h = 0;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(word));
+    h = (h ^ word) * UINT64_C(0x9e3779b97f4a7c15);
+    h ^= h >> 32;
+  }
+  for (; i < size; i++) {
+    h = (h ^ bytes[i]) * UINT64_C(0x9e3779b97f4a7c15);
+  }
+  return (uint32_t) (h ^ (h >> 32));
+}
+
+// The number of slots of the hash index of an array of count permutations,
+// which is the smallest power of two of at least 2 * count.
+static inline uint32_t index_slot_count(unsigned int count) {
+  uint32_t n_slots = 1;
+  while (n_slots < 2 * count) {
+    n_slots *= 2;
+  }
+  return n_slots;
+}
+
+// Builds the hash table that index_of_permutation_in_array uses to find
+// permutations in the array in expected constant time. The table has at least
+// twice as many slots as the array has permutations and is never freed.
+static inline int index_permutation_array(permutation_array* array) {
+  const uint32_t n_slots = index_slot_count(array->count);
+  uint32_t* slots = calloc(n_slots, sizeof(uint32_t));
+  if (slots == NULL) {
+    return 0;
+  }
+  const uint32_t mask = n_slots - 1;
+  STACK_ALLOC_PERMUTATION(buf, array->domain);
+  for (unsigned int i = 0; i < array->count; i++) {
+    const permutation element = load_permutation_from_array(array, i, &buf);
+    uint32_t slot = hash_permutation(&element) & mask;
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = i + 1;
+  }
+  array->index = slots;
+  array->index_mask = mask;
+  return 1;
 }
 
 static inline int index_of_permutation_in_array(const permutation* p,
                                                 const permutation_array* array,
                                                 unsigned int* perm_index) {
-  // TODO: ensure domain is the same
-  for (unsigned int i = 0; i < array->count; i++) {
-    unsigned int j;
-    for (j = 1; j <= array->domain; j++) {
-      // TODO: LIKELY macro
-      if (PERMUTATION_GET(p, j) != PERMUTATION_ARRAY_GET(array, i, j)) {
-        break;
+  assert(p->domain == array->domain);
+  const size_t size = permutation_mapping_size(p->domain);
+  STACK_ALLOC_PERMUTATION(buf, array->domain);
+  if (array->index != NULL) {
+    uint32_t slot = hash_permutation(p) & array->index_mask;
+    for (; array->index[slot] != 0; slot = (slot + 1) & array->index_mask) {
+      const unsigned int i = array->index[slot] - 1;
+      const permutation element = load_permutation_from_array(array, i, &buf);
+      if (memcmp(permutation_mapping_bytes(p),
+                 permutation_mapping_bytes(&element), size) == 0) {
+        *perm_index = i;
+        return 1;
       }
     }
-    if (j > array->domain) {
+    return 0;
+  }
+  for (unsigned int i = 0; i < array->count; i++) {
+    const permutation element = load_permutation_from_array(array, i, &buf);
+    if (memcmp(permutation_mapping_bytes(p),
+               permutation_mapping_bytes(&element), size) == 0) {
       *perm_index = i;
       return 1;
     }
@@ -148,19 +586,215 @@ static inline int index_of_permutation_in_array(const permutation* p,
   return 0;
 }
 
+// Fused operations that are used by the protocol. Each parameter set provides
+// an instance that is specialized for its domain, such that all loops have a
+// constant trip count. All permutations must have the domain of the instance,
+// and dst must not alias any other argument.
+typedef struct {
+  // dst = a * b * c.
+  void (*compose3)(permutation* dst, const permutation* a, const permutation* b,
+                   const permutation* c);
+  // dst = tau^-1 * f[index] * tau.
+  void (*conjugate)(permutation* dst, const permutation_array* f,
+                    unsigned int index, const permutation* tau);
+  // dst = tau^-1 * x * tau * sigma.
+  void (*conjugate_compose)(permutation* dst, const permutation* x,
+                            const permutation* tau, const permutation* sigma);
+  // dst = f[index] * sigma.
+  void (*compose)(permutation* dst, const permutation_array* f,
+                  unsigned int index, const permutation* sigma);
+} permutation_engine;
+
+// Evaluates to the mapping of the permutation at the given index of the array
+// with n points, which is computed into buf if the array is implicit.
+#define PERMUTATION_ARRAY_ROW(array, member, perm_index, n, buf)               \
+  ((array)->implicit == NULL                                                   \
+       ? (array)->base.member +                                                \
+             (size_t) (perm_index) * PERMUTATION_ARRAY_STRIDE(n)               \
+       : compute_permutation_row_##member((array), (perm_index), (n), (buf)))
+
+// Defines the functions of a permutation_engine named name for permutations
+// whose mapping member is of the given type, on a domain of n points. The
+// expression n may refer to the destination permutation dst.
+//
+// Since (tau^-1 * f * tau)(tau(y)) = tau(f(y)), all products are computed in a
+// single pass, without inverting or extracting any permutation first.
+#define DEFINE_PERMUTATION_ENGINE_FUNCTIONS(name, member, type, n)             \
+  static void name##_compose3(permutation* dst, const permutation* a,         \
+                              const permutation* b, const permutation* c) {    \
+    type* restrict d = dst->mapping.member;                                    \
+    const type* p = a->mapping.member;                                         \
+    const type* q = b->mapping.member;                                         \
+    const type* r = c->mapping.member;                                         \
+    for (unsigned int x = 0; x < (n); x++) {                                   \
+      d[x] = r[q[p[x] - 1] - 1];                                               \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void name##_conjugate(permutation* dst, const permutation_array* f,   \
+                               unsigned int index, const permutation* tau) {   \
+    type row[(n)];                                                             \
+    const type* g = PERMUTATION_ARRAY_ROW(f, member, index, n, row);           \
+    type* restrict d = dst->mapping.member;                                    \
+    const type* t = tau->mapping.member;                                       \
+    for (unsigned int y = 0; y < (n); y++) {                                   \
+      d[t[y] - 1] = t[g[y] - 1];                                               \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void name##_conjugate_compose(permutation* dst, const permutation* x, \
+                                       const permutation* tau,                 \
+                                       const permutation* sigma) {             \
+    type* restrict d = dst->mapping.member;                                    \
+    const type* m = x->mapping.member;                                         \
+    const type* t = tau->mapping.member;                                       \
+    const type* s = sigma->mapping.member;                                     \
+    for (unsigned int y = 0; y < (n); y++) {                                   \
+      d[t[y] - 1] = s[t[m[y] - 1] - 1];                                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  static void name##_compose(permutation* dst, const permutation_array* f,     \
+                             unsigned int index, const permutation* sigma) {   \
+    type row[(n)];                                                             \
+    const type* g = PERMUTATION_ARRAY_ROW(f, member, index, n, row);           \
+    type* restrict d = dst->mapping.member;                                    \
+    const type* s = sigma->mapping.member;                                     \
+    for (unsigned int y = 0; y < (n); y++) {                                   \
+      d[y] = s[g[y] - 1];                                                      \
+    }                                                                          \
+  }
+
+// Defines a permutation_engine named name that is specialized for a domain of
+// exactly n points, whose mapping member is of the given type.
+#define DEFINE_PERMUTATION_ENGINE(name, member, type, n)                       \
+  DEFINE_PERMUTATION_ENGINE_FUNCTIONS(name, member, type, n)                   \
+  static const permutation_engine name = {                                     \
+    .compose3 = name##_compose3,                                               \
+    .conjugate = name##_conjugate,                                             \
+    .conjugate_compose = name##_conjugate_compose,                             \
+    .compose = name##_compose,                                                 \
+  }
+
+// Handles any domain, for parameter sets that do not provide a specialized
+// instance.
+extern const permutation_engine generic_permutation_engine;
+
+// Maps the given arrays, including their hash indexes, from the table cache
+// file of the named parameter set, if a cache directory has been set and the
+// file is valid for arrays of the given domains and sizes. Every stored row
+// must be a permutation, and every index must have the slot count of
+// index_permutation_array, in-range entries, and an empty slot. The mapping is
+// read-only and shared with all other processes.
+int map_cached_permutation_arrays(const char* name,
+                                  permutation_array* const* arrays,
+                                  unsigned int n_arrays);
+
+// Unmaps arrays that map_cached_permutation_arrays has mapped. Parameter sets
+// keep their mappings forever, so this is only needed by tests.
+void unmap_cached_permutation_arrays(permutation_array* const* arrays,
+                                     unsigned int n_arrays);
+
+// Atomically replaces the table cache file of the named parameter set with the
+// contents of the given arrays, which must not be implicit.
+int write_cached_permutation_arrays(const char* name,
+                                    permutation_array* const* arrays,
+                                    unsigned int n_arrays);
+
+// A stabilizer chain of a permutation group G, for the base points b_0, ...,
+// b_{k-1}, where each level of the chain covers one or more consecutive base
+// points. Let G_l be the pointwise stabilizer of the base points of all levels
+// before l. Then the transversal of level l holds, for each image of the base
+// points of the level under G_l, one element of G_l that maps them to it. Each
+// element of G is the product of exactly one element of each transversal,
+// applied from the last level to the first, so that choosing each of them
+// uniformly yields a uniformly random element of G.
 typedef struct {
-  void (*random_element)(permutation* out, const zkp_params* params);
+  unsigned int n_levels;
+  // The base points of level l are base[first_base[l]], ...,
+  // base[first_base[l + 1] - 1].
+  const unsigned int* base;
+  const unsigned int* first_base;
+  // The transversal of level l consists of the elements offsets[l], ...,
+  // offsets[l + 1] - 1 of transversals.
+  const unsigned int* offsets;
+  permutation_array transversals;
+} stabilizer_chain;
+
+// Builds the stabilizer chain of the group that is generated by the elements
+// of the given arrays. The chain is never freed.
+int build_stabilizer_chain(stabilizer_chain* chain,
+                           const permutation_array* const* generators,
+                           unsigned int n_arrays);
+
+// Returns 1 if g is an element of the group that the chain describes.
+int stabilizer_chain_contains(const stabilizer_chain* chain,
+                              const permutation* g);
+
+typedef struct {
+  void (*random_element)(permutation* out, const zkp_params* params,
+                         random_source* source);
+  // The stabilizer chain of the group, if random_element uses one.
+  const stabilizer_chain* chain;
 } permutation_group;
 
+// Runs init exactly once, even if multiple threads call this concurrently. All
+// callers return after init has completed.
+#ifndef __WASM__
+typedef pthread_once_t init_once_flag;
+#define INIT_ONCE_FLAG PTHREAD_ONCE_INIT
+
+static inline void init_once(init_once_flag* flag, void (*init)(void)) {
+  int ret = pthread_once(flag, init);
+  assert(ret == 0);
+  (void) ret;
+}
+#else
+typedef int init_once_flag;
+#define INIT_ONCE_FLAG 0
+
+static inline void init_once(init_once_flag* flag, void (*init)(void)) {
+  if (!*flag) {
+    init();
+    *flag = 1;
+  }
+}
+#endif
+
 struct zkp_params_s {
   unsigned int domain;
   permutation_array F;
   permutation_array H;
   permutation_group G_;
+  const permutation_engine* engine;
+  // If not NULL, conjugates[tau * F.count + i] is the index of the conjugate
+  // H[tau]^-1 * F[i] * H[tau] in F. Otherwise, the conjugate is looked up in F.
+  const uint8_t* conjugates;
+  // If not zero, H[k] = h^k for a generator h, and F[k] = H[k]^-1 * F[0] * H[k]
+  // with |F| = |H|. Then H[k]^-1 = H[(|H| - k) mod |H|], and the conjugate
+  // H[tau]^-1 * F[i] * H[tau] is F[(i + tau) mod |F|].
+  int cyclic;
+  // If not NULL, the portable representations of all elements of H, one after
+  // another. Only large permutations need to be encoded, small ones are stored
+  // in their portable representation already.
+  const unsigned char* h_reprs;
   unsigned int d;
+  // The default commitment scheme of proofs and verifications.
+  const commitment_scheme* commitment;
   const char* display_name;
 };
 
+// Stores the portable representations of all elements of the array in reprs,
+// one after another.
+void encode_permutation_array_reprs(const permutation_array* array,
+                                    unsigned char* reprs);
+
+// Replaces the implicit arrays F and H of the named parameter set by tables,
+// which are mapped from the table cache if possible. Otherwise, the tables are
+// computed by the number of threads passed to zkp_params_preload, and written
+// to the table cache.
+void materialize_params_tables(zkp_params* params, const char* name);
+
 struct zkp_private_key_s {
   const zkp_params* params;
   unsigned int* i;
@@ -170,6 +804,11 @@ struct zkp_private_key_s {
 struct zkp_public_key_s {
   const zkp_params* params;
   permutation x0;
+  // Once zkp_prepare_public_key has been called for parameters with a small H,
+  // x0_conjugates[tau] = H[tau]^-1 * x0 * H[tau], stored in
+  // x0_conjugates_storage. Otherwise, x0_conjugates_storage is NULL.
+  permutation_array x0_conjugates;
+  void* x0_conjugates_storage;
   zkp_public_key* mut_self;
 };
 
@@ -198,47 +837,84 @@ struct zkp_answer_s {
   } q_ne_0;
 };
 
+// The question of a round that has not been asked or answered yet.
+#define Q_NONE ((unsigned int) -1)
+
+// Number of preallocated temporary permutations in proofs and verifications,
+// which avoids variable-length arrays in the protocol.
+#define N_SCRATCH_PERMUTATIONS 3
+
 struct zkp_proof_s {
   const zkp_private_key* key;
+  // The prefix products P_j = F[i_j]^-1 * ... * F[i_1]^-1 for j = 1, ..., d,
+  // which only depend on the private key. Since the conjugates of F[i_j] by tau
+  // telescope, sigma_j = tau^-1 * P_j * tau * sigma_0, so that each round
+  // computes all sigma_j independently of each other from the same P_j.
+  permutation* prefix;
+  // The expanded private key, which replaces the prefix products if H is small
+  // enough for the conjugates table of the parameters. Then the index of
+  // tau^-1 * F[i_j] * tau in F is c = conjugates[tau * d + j - 1], and
+  // f_inv[k] = F[k]^-1, so that sigma_j = f_inv[c] * sigma_{j-1} takes a
+  // single composition of stored permutations. Otherwise, both are NULL.
+  uint8_t* conjugates;
+  permutation* f_inv;
   struct {
     zkp_round_secrets secrets;
+    // The portable representations of sigma_0, ..., sigma_d, one after
+    // another, which are committed to at once. NULL if the domain is small,
+    // since small permutations are stored in their portable representation.
+    unsigned char* sigma_reprs;
     unsigned char* commitments;
     zkp_answer answer;
   } round;
+  commitment_engine commitment;
+  permutation scratch[N_SCRATCH_PERMUTATIONS];
+  // The source of all random choices, which is NULL unless the proof has been
+  // seeded by zkp_insecure_seed_proof.
+  random_source* rng;
 };
 
+typedef struct cached_public_key_s cached_public_key;
+
 struct zkp_verification_s {
   const zkp_public_key* key;
+  // The entry of the public key cache that the key belongs to, if any.
+  cached_public_key* cache_entry;
   unsigned int q;
   unsigned int n_successful_rounds;
   zkp_answer imported_answer;
+  // Its scheme must match the commitment scheme of the proof.
+  commitment_engine commitment;
+  permutation scratch[N_SCRATCH_PERMUTATIONS];
+  // See zkp_proof_s.
+  random_source* rng;
 };
 
-static inline void random_element_F_H(permutation* out,
-                                      const zkp_params* params) {
+// Returns the verification to its cache entry for reuse, or only releases its
+// reference to the entry. Returns 1 if the verification must not be freed.
+int release_cached_verification(zkp_verification* verification);
+
+// Draws a uniformly random element of the group from its stabilizer chain.
+static inline void random_element_stabilizer_chain(permutation* out,
+                                                   const zkp_params* params,
+                                                   random_source* source) {
+  const stabilizer_chain* chain = params->G_.chain;
   identity_permutation(out);
-  const unsigned int m = params->d * 2;
-  // We want F and H to be equally likely so we can choose a small value for m.
-  unsigned int f_factor = params->H.count / params->F.count;
-  for (unsigned int i = 0; i < m; i++) {
-    unsigned int j =
-        rand_less_than(params->H.count + f_factor * params->F.count);
-    multiply_permutation_from_array(
-        out, j < params->H.count ? &params->H : &params->F,
-        j < params->H.count ? j : (j - params->H.count) % params->F.count);
+  for (unsigned int l = chain->n_levels; l-- > 0;) {
+    const unsigned int k = rand_less_than_from(
+        source, chain->offsets[l + 1] - chain->offsets[l]);
+    multiply_permutation_from_array(out, &chain->transversals,
+                                    chain->offsets[l] + k);
   }
 }
 
 static inline void random_element_symmetric_group(permutation* out,
-                                                  const zkp_params* params) {
+                                                  const zkp_params* params,
+                                                  random_source* source) {
   (void) params;
-  identity_permutation(out);
-  for (unsigned int i = 2; i <= out->domain; i++) {
-    unsigned int j = 1 + rand_less_than(i);
-    if (j != i) {
-      unsigned int t = PERMUTATION_GET(out, i);
-      PERMUTATION_SET(out, i, PERMUTATION_GET(out, j));
-      PERMUTATION_SET(out, j, t);
-    }
+  if (PERMUTATION_IS_SMALL(out)) {
+    random_permutations_small(source, out->mapping.small, 0, out->domain, 1);
+  } else {
+    random_permutations_large(source, out->mapping.large, 0, out->domain, 1);
   }
 }
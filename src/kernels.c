@@ -0,0 +1,576 @@
+#include "kernels.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(__WASM__)
+#define HAVE_X86_SHUFFLE_KERNELS
+#include <immintrin.h>
+#endif
+
+static int always_supported(void) {
+  return 1;
+}
+
+static void compose_scalar(uint8_t* dst, const uint8_t* a, const uint8_t* b,
+                           unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[i] = b[a[i] - 1];
+  }
+}
+
+static void inverse_scalar(uint8_t* dst, const uint8_t* a, unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[a[i] - 1] = (uint8_t) (i + 1);
+  }
+}
+
+static void inverse_compose_scalar(uint8_t* dst, const uint8_t* a,
+                                   const uint8_t* b, unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[a[i] - 1] = b[i];
+  }
+}
+
+// Since (h^-1 * f * h)(h(i)) = h(f(i)), the conjugation can be computed in a
+// single pass without inverting h first.
+static void conjugate_scalar(uint8_t* dst, const uint8_t* f, const uint8_t* h,
+                             unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[h[i] - 1] = h[f[i] - 1];
+  }
+}
+
+// Builds a composition with an inverse from a composition kernel, which must
+// allow dst to alias its first operand.
+static inline void compose_inverse_with(
+    void (*compose)(uint8_t*, const uint8_t*, const uint8_t*, unsigned int),
+    uint8_t* dst, const uint8_t* a, const uint8_t* b, unsigned int n) {
+  uint8_t b_inv[MAX_DOMAIN_SMALL_REPR];
+  inverse_scalar(b_inv, b, n);
+  compose(dst, a, b_inv, n);
+}
+
+static void compose_inverse_scalar(uint8_t* dst, const uint8_t* a,
+                                   const uint8_t* b, unsigned int n) {
+  compose_inverse_with(compose_scalar, dst, a, b, n);
+}
+
+static const shuffle_kernels shuffle_kernels_scalar = {
+  .name = "scalar",
+  .is_supported = always_supported,
+  .compose = compose_scalar,
+  .compose_inverse = compose_inverse_scalar,
+  .inverse_compose = inverse_compose_scalar,
+  .inverse = inverse_scalar,
+  .conjugate = conjugate_scalar,
+};
+
+static void compose_wide_scalar(uint16_t* dst, const uint16_t* a,
+                                const uint16_t* b, unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[i] = b[a[i] - 1];
+  }
+}
+
+static void inverse_wide_scalar(uint16_t* dst, const uint16_t* a,
+                                unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[a[i] - 1] = (uint16_t) (i + 1);
+  }
+}
+
+static void inverse_compose_wide_scalar(uint16_t* dst, const uint16_t* a,
+                                        const uint16_t* b, unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[a[i] - 1] = b[i];
+  }
+}
+
+static void conjugate_wide_scalar(uint16_t* dst, const uint16_t* f,
+                                  const uint16_t* h, unsigned int n) {
+  for (unsigned int i = 0; i < n; i++) {
+    dst[h[i] - 1] = h[f[i] - 1];
+  }
+}
+
+// Same as compose_inverse_with, but for large permutations.
+static inline void compose_inverse_wide_with(
+    void (*compose)(uint16_t*, const uint16_t*, const uint16_t*, unsigned int),
+    uint16_t* dst, const uint16_t* a, const uint16_t* b, unsigned int n) {
+  uint16_t b_inv[MAX_DOMAIN_LARGE_REPR];
+  assert(n <= MAX_DOMAIN_LARGE_REPR);
+  inverse_wide_scalar(b_inv, b, n);
+  compose(dst, a, b_inv, n);
+}
+
+// Builds a conjugation from a composition kernel, which must allow dst to alias
+// its first operand.
+static inline void conjugate_wide_with(
+    void (*compose)(uint16_t*, const uint16_t*, const uint16_t*, unsigned int),
+    uint16_t* dst, const uint16_t* f, const uint16_t* h, unsigned int n) {
+  uint16_t h_inv[MAX_DOMAIN_LARGE_REPR];
+  assert(n <= MAX_DOMAIN_LARGE_REPR);
+  inverse_wide_scalar(h_inv, h, n);
+  compose(dst, h_inv, f, n);
+  compose(dst, dst, h, n);
+}
+
+static void compose_inverse_wide_scalar(uint16_t* dst, const uint16_t* a,
+                                        const uint16_t* b, unsigned int n) {
+  compose_inverse_wide_with(compose_wide_scalar, dst, a, b, n);
+}
+
+static const gather_kernels gather_kernels_scalar = {
+  .name = "scalar",
+  .is_supported = always_supported,
+  .compose = compose_wide_scalar,
+  .compose_inverse = compose_inverse_wide_scalar,
+  .inverse_compose = inverse_compose_wide_scalar,
+  .inverse = inverse_wide_scalar,
+  .conjugate = conjugate_wide_scalar,
+};
+
+#ifdef HAVE_X86_SHUFFLE_KERNELS
+
+// There is no vectorized byte scatter that beats the scalar loop, so all
+// vectorized implementations compute inverses using inverse_scalar, and
+// products with an inverse on the left using inverse_compose_scalar.
+
+#define AVX512_TARGET __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+AVX512_TARGET static inline __mmask64 avx512_domain_mask(unsigned int n) {
+  return n == MAX_DOMAIN_SHUFFLE ? ~(__mmask64) 0
+                                 : (((__mmask64) 1) << n) - 1;
+}
+
+// Converts labels into zero-based indices. Lanes outside of the domain wrap
+// around, but are never stored.
+AVX512_TARGET static inline __m512i avx512_load_indices(const uint8_t* p,
+                                                        __mmask64 mask) {
+  return _mm512_sub_epi8(_mm512_maskz_loadu_epi8(mask, p),
+                         _mm512_set1_epi8(1));
+}
+
+AVX512_TARGET static void compose_avx512vbmi(uint8_t* dst, const uint8_t* a,
+                                             const uint8_t* b, unsigned int n) {
+  if (n > MAX_DOMAIN_SHUFFLE) {
+    compose_scalar(dst, a, b, n);
+    return;
+  }
+  const __mmask64 mask = avx512_domain_mask(n);
+  __m512i x = avx512_load_indices(a, mask);
+  __m512i t = _mm512_maskz_loadu_epi8(mask, b);
+  _mm512_mask_storeu_epi8(dst, mask, _mm512_permutexvar_epi8(x, t));
+}
+
+AVX512_TARGET static void conjugate_avx512vbmi(uint8_t* dst, const uint8_t* f,
+                                               const uint8_t* h,
+                                               unsigned int n) {
+  if (n > MAX_DOMAIN_SHUFFLE) {
+    conjugate_scalar(dst, f, h, n);
+    return;
+  }
+  uint8_t h_inv[MAX_DOMAIN_SHUFFLE];
+  inverse_scalar(h_inv, h, n);
+  const __mmask64 mask = avx512_domain_mask(n);
+  __m512i one = _mm512_set1_epi8(1);
+  __m512i x = avx512_load_indices(h_inv, mask);
+  __m512i y = _mm512_permutexvar_epi8(x, _mm512_maskz_loadu_epi8(mask, f));
+  __m512i z = _mm512_permutexvar_epi8(_mm512_sub_epi8(y, one),
+                                      _mm512_maskz_loadu_epi8(mask, h));
+  _mm512_mask_storeu_epi8(dst, mask, z);
+}
+
+AVX512_TARGET static void compose_inverse_avx512vbmi(uint8_t* dst,
+                                                     const uint8_t* a,
+                                                     const uint8_t* b,
+                                                     unsigned int n) {
+  compose_inverse_with(compose_avx512vbmi, dst, a, b, n);
+}
+
+static int avx512vbmi_supported(void) {
+  return __builtin_cpu_supports("avx512bw") &&
+         __builtin_cpu_supports("avx512vbmi");
+}
+
+static const shuffle_kernels shuffle_kernels_avx512vbmi = {
+  .name = "avx512vbmi",
+  .is_supported = avx512vbmi_supported,
+  .compose = compose_avx512vbmi,
+  .compose_inverse = compose_inverse_avx512vbmi,
+  .inverse_compose = inverse_compose_scalar,
+  .inverse = inverse_scalar,
+  .conjugate = conjugate_avx512vbmi,
+};
+
+// Without vpermb, a 64-byte table is split into (up to) four 16-byte chunks,
+// each of which is looked up using pshufb. The results are then merged based on
+// the upper two bits of each index. To avoid reading beyond the end of the
+// arrays, the last (partial) vector of each array overlaps the previous one.
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+
+// Loads the k-th 16-byte chunk of the table t. Bytes beyond the end of the
+// table are unspecified. Requires n >= 16.
+SSSE3_TARGET static inline __m128i load_table_chunk(const uint8_t* t,
+                                                    unsigned int k,
+                                                    unsigned int n) {
+  if (16 * k + 16 <= n) {
+    return _mm_loadu_si128((const __m128i*) (t + 16 * k));
+  }
+  __m128i tail = _mm_loadu_si128((const __m128i*) (t + n - 16));
+  __m128i shift = _mm_add_epi8(
+      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+      _mm_set1_epi8((char) (16 * k + 16 - n)));
+  return _mm_shuffle_epi8(tail, shift);
+}
+
+AVX2_TARGET static inline __m256i avx2_lookup(__m256i x, const __m256i* chunks,
+                                              unsigned int n_chunks) {
+  __m256i hi = _mm256_and_si256(x, _mm256_set1_epi8(0x30));
+  __m256i r = _mm256_setzero_si256();
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    __m256i m = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8((char) (16 * k)));
+    r = _mm256_or_si256(r,
+                        _mm256_and_si256(m, _mm256_shuffle_epi8(chunks[k], x)));
+  }
+  return r;
+}
+
+AVX2_TARGET static inline unsigned int avx2_load_table(__m256i* chunks,
+                                                       const uint8_t* t,
+                                                       unsigned int n) {
+  unsigned int n_chunks = (n + 15) / 16;
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    chunks[k] = _mm256_broadcastsi128_si256(load_table_chunk(t, k, n));
+  }
+  return n_chunks;
+}
+
+// Computes t[x - 1] for the labels x at p[0..31] and p[n-32..n-1], loading both
+// before storing either of them so that dst may alias p. Requires n >= 32.
+AVX2_TARGET static inline void avx2_apply(uint8_t* dst, const uint8_t* p,
+                                          const __m256i* chunks,
+                                          unsigned int n_chunks,
+                                          unsigned int n) {
+  __m256i one = _mm256_set1_epi8(1);
+  __m256i x0 = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i*) p), one);
+  __m256i x1 =
+      _mm256_sub_epi8(_mm256_loadu_si256((const __m256i*) (p + n - 32)), one);
+  __m256i r0 = avx2_lookup(x0, chunks, n_chunks);
+  __m256i r1 = avx2_lookup(x1, chunks, n_chunks);
+  _mm256_storeu_si256((__m256i*) dst, r0);
+  _mm256_storeu_si256((__m256i*) (dst + n - 32), r1);
+}
+
+AVX2_TARGET static void compose_avx2(uint8_t* dst, const uint8_t* a,
+                                     const uint8_t* b, unsigned int n) {
+  if (n < 32 || n > MAX_DOMAIN_SHUFFLE) {
+    compose_scalar(dst, a, b, n);
+    return;
+  }
+  __m256i chunks[4];
+  unsigned int n_chunks = avx2_load_table(chunks, b, n);
+  avx2_apply(dst, a, chunks, n_chunks, n);
+}
+
+AVX2_TARGET static void conjugate_avx2(uint8_t* dst, const uint8_t* f,
+                                       const uint8_t* h, unsigned int n) {
+  if (n < 32 || n > MAX_DOMAIN_SHUFFLE) {
+    conjugate_scalar(dst, f, h, n);
+    return;
+  }
+  uint8_t h_inv[MAX_DOMAIN_SHUFFLE];
+  inverse_scalar(h_inv, h, n);
+  __m256i chunks[4];
+  unsigned int n_chunks = avx2_load_table(chunks, f, n);
+  avx2_apply(dst, h_inv, chunks, n_chunks, n);
+  n_chunks = avx2_load_table(chunks, h, n);
+  avx2_apply(dst, dst, chunks, n_chunks, n);
+}
+
+AVX2_TARGET static void compose_inverse_avx2(uint8_t* dst, const uint8_t* a,
+                                             const uint8_t* b, unsigned int n) {
+  compose_inverse_with(compose_avx2, dst, a, b, n);
+}
+
+static int avx2_supported(void) {
+  return __builtin_cpu_supports("avx2");
+}
+
+static const shuffle_kernels shuffle_kernels_avx2 = {
+  .name = "avx2",
+  .is_supported = avx2_supported,
+  .compose = compose_avx2,
+  .compose_inverse = compose_inverse_avx2,
+  .inverse_compose = inverse_compose_scalar,
+  .inverse = inverse_scalar,
+  .conjugate = conjugate_avx2,
+};
+
+SSSE3_TARGET static inline __m128i ssse3_lookup(__m128i x,
+                                                const __m128i* chunks,
+                                                unsigned int n_chunks) {
+  __m128i hi = _mm_and_si128(x, _mm_set1_epi8(0x30));
+  __m128i r = _mm_setzero_si128();
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    __m128i m = _mm_cmpeq_epi8(hi, _mm_set1_epi8((char) (16 * k)));
+    r = _mm_or_si128(r, _mm_and_si128(m, _mm_shuffle_epi8(chunks[k], x)));
+  }
+  return r;
+}
+
+// Same as avx2_apply, but in 16-byte blocks. Requires n >= 16.
+SSSE3_TARGET static inline void ssse3_apply(uint8_t* dst, const uint8_t* p,
+                                            const __m128i* chunks,
+                                            unsigned int n_chunks,
+                                            unsigned int n) {
+  __m128i one = _mm_set1_epi8(1);
+  __m128i r[4];
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    unsigned int offset = 16 * k + 16 <= n ? 16 * k : n - 16;
+    __m128i x = _mm_sub_epi8(_mm_loadu_si128((const __m128i*) (p + offset)),
+                             one);
+    r[k] = ssse3_lookup(x, chunks, n_chunks);
+  }
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    unsigned int offset = 16 * k + 16 <= n ? 16 * k : n - 16;
+    _mm_storeu_si128((__m128i*) (dst + offset), r[k]);
+  }
+}
+
+SSSE3_TARGET static inline unsigned int ssse3_load_table(__m128i* chunks,
+                                                         const uint8_t* t,
+                                                         unsigned int n) {
+  unsigned int n_chunks = (n + 15) / 16;
+  for (unsigned int k = 0; k < n_chunks; k++) {
+    chunks[k] = load_table_chunk(t, k, n);
+  }
+  return n_chunks;
+}
+
+SSSE3_TARGET static void compose_ssse3(uint8_t* dst, const uint8_t* a,
+                                       const uint8_t* b, unsigned int n) {
+  if (n < 16 || n > MAX_DOMAIN_SHUFFLE) {
+    compose_scalar(dst, a, b, n);
+    return;
+  }
+  __m128i chunks[4];
+  unsigned int n_chunks = ssse3_load_table(chunks, b, n);
+  ssse3_apply(dst, a, chunks, n_chunks, n);
+}
+
+SSSE3_TARGET static void conjugate_ssse3(uint8_t* dst, const uint8_t* f,
+                                         const uint8_t* h, unsigned int n) {
+  if (n < 16 || n > MAX_DOMAIN_SHUFFLE) {
+    conjugate_scalar(dst, f, h, n);
+    return;
+  }
+  uint8_t h_inv[MAX_DOMAIN_SHUFFLE];
+  inverse_scalar(h_inv, h, n);
+  __m128i chunks[4];
+  unsigned int n_chunks = ssse3_load_table(chunks, f, n);
+  ssse3_apply(dst, h_inv, chunks, n_chunks, n);
+  n_chunks = ssse3_load_table(chunks, h, n);
+  ssse3_apply(dst, dst, chunks, n_chunks, n);
+}
+
+SSSE3_TARGET static void compose_inverse_ssse3(uint8_t* dst, const uint8_t* a,
+                                               const uint8_t* b,
+                                               unsigned int n) {
+  compose_inverse_with(compose_ssse3, dst, a, b, n);
+}
+
+static int ssse3_supported(void) {
+  return __builtin_cpu_supports("ssse3");
+}
+
+static const shuffle_kernels shuffle_kernels_ssse3 = {
+  .name = "ssse3",
+  .is_supported = ssse3_supported,
+  .compose = compose_ssse3,
+  .compose_inverse = compose_inverse_ssse3,
+  .inverse_compose = inverse_compose_scalar,
+  .inverse = inverse_scalar,
+  .conjugate = conjugate_ssse3,
+};
+
+// Large permutations do not fit into a single register, so the AVX-512 variant
+// holds the table in up to 16 registers of 32 points each and looks up every
+// index in each pair of registers using vpermi2w, keeping the result from the
+// pair that is selected by the upper bits of the index.
+
+#define AVX512BW_TARGET __attribute__((target("avx512f,avx512bw")))
+
+AVX512BW_TARGET static inline __mmask32 avx512_block_mask(unsigned int rem) {
+  return rem >= 32 ? ~(__mmask32) 0 : (((__mmask32) 1) << rem) - 1;
+}
+
+AVX512BW_TARGET static void compose_wide_avx512bw(uint16_t* dst,
+                                                  const uint16_t* a,
+                                                  const uint16_t* b,
+                                                  unsigned int n) {
+  if (n > MAX_DOMAIN_BLOCKED_SHUFFLE) {
+    compose_wide_scalar(dst, a, b, n);
+    return;
+  }
+
+  __m512i table[MAX_DOMAIN_BLOCKED_SHUFFLE / 32 + 1];
+  const unsigned int n_blocks = (n + 31) / 32;
+  for (unsigned int k = 0; k < n_blocks; k++) {
+    table[k] = _mm512_maskz_loadu_epi16(avx512_block_mask(n - 32 * k),
+                                        b + 32 * k);
+  }
+  table[n_blocks] = _mm512_setzero_si512();
+
+  for (unsigned int i = 0; i < n; i += 32) {
+    __mmask32 mask = avx512_block_mask(n - i);
+    __m512i x = _mm512_sub_epi16(_mm512_maskz_loadu_epi16(mask, a + i),
+                                 _mm512_set1_epi16(1));
+    __m512i pair = _mm512_srli_epi16(x, 6);
+    __m512i r = _mm512_setzero_si512();
+    for (unsigned int k = 0; k < n_blocks; k += 2) {
+      __m512i v = _mm512_permutex2var_epi16(table[k], x, table[k + 1]);
+      __mmask32 sel =
+          _mm512_cmpeq_epi16_mask(pair, _mm512_set1_epi16((short) (k / 2)));
+      r = _mm512_mask_mov_epi16(r, sel, v);
+    }
+    _mm512_mask_storeu_epi16(dst + i, mask, r);
+  }
+}
+
+AVX512BW_TARGET static void conjugate_wide_avx512bw(uint16_t* dst,
+                                                    const uint16_t* f,
+                                                    const uint16_t* h,
+                                                    unsigned int n) {
+  conjugate_wide_with(compose_wide_avx512bw, dst, f, h, n);
+}
+
+AVX512BW_TARGET static void compose_inverse_wide_avx512bw(uint16_t* dst,
+                                                          const uint16_t* a,
+                                                          const uint16_t* b,
+                                                          unsigned int n) {
+  compose_inverse_wide_with(compose_wide_avx512bw, dst, a, b, n);
+}
+
+static int avx512bw_supported(void) {
+  return __builtin_cpu_supports("avx512bw");
+}
+
+static const gather_kernels gather_kernels_avx512bw = {
+  .name = "avx512bw",
+  .is_supported = avx512bw_supported,
+  .compose = compose_wide_avx512bw,
+  .compose_inverse = compose_inverse_wide_avx512bw,
+  .inverse_compose = inverse_compose_wide_scalar,
+  .inverse = inverse_wide_scalar,
+  .conjugate = conjugate_wide_avx512bw,
+};
+
+// The AVX2 variant gathers 32-bit values at each 16-bit entry and keeps the
+// lower half. Lanes that refer to the last entry are not gathered since that
+// would read beyond the end of the table; they are filled in directly instead.
+AVX2_TARGET static void compose_wide_avx2(uint16_t* dst, const uint16_t* a,
+                                          const uint16_t* b, unsigned int n) {
+  const int* base = (const int*) (const void*) b;
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i last_label = _mm256_set1_epi32((int) n);
+  const __m256i last_value = _mm256_set1_epi32(b[n - 1]);
+  const __m256i all_ones = _mm256_set1_epi32(-1);
+  const __m256i lower_half = _mm256_set1_epi32(0xffff);
+
+  unsigned int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i x =
+        _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (a + i)));
+    __m256i is_last = _mm256_cmpeq_epi32(x, last_label);
+    __m256i v = _mm256_mask_i32gather_epi32(
+        last_value, base, _mm256_sub_epi32(x, one),
+        _mm256_xor_si256(is_last, all_ones), 2);
+    v = _mm256_and_si256(v, lower_half);
+    __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(v),
+                                      _mm256_extracti128_si256(v, 1));
+    _mm_storeu_si128((__m128i*) (dst + i), packed);
+  }
+  for (; i < n; i++) {
+    dst[i] = b[a[i] - 1];
+  }
+}
+
+AVX2_TARGET static void conjugate_wide_avx2(uint16_t* dst, const uint16_t* f,
+                                            const uint16_t* h, unsigned int n) {
+  conjugate_wide_with(compose_wide_avx2, dst, f, h, n);
+}
+
+AVX2_TARGET static void compose_inverse_wide_avx2(uint16_t* dst,
+                                                  const uint16_t* a,
+                                                  const uint16_t* b,
+                                                  unsigned int n) {
+  compose_inverse_wide_with(compose_wide_avx2, dst, a, b, n);
+}
+
+static const gather_kernels gather_kernels_avx2 = {
+  .name = "avx2",
+  .is_supported = avx2_supported,
+  .compose = compose_wide_avx2,
+  .compose_inverse = compose_inverse_wide_avx2,
+  .inverse_compose = inverse_compose_wide_scalar,
+  .inverse = inverse_wide_scalar,
+  .conjugate = conjugate_wide_avx2,
+};
+
+#endif  // HAVE_X86_SHUFFLE_KERNELS
+
+const shuffle_kernels* const all_shuffle_kernels[] = {
+#ifdef HAVE_X86_SHUFFLE_KERNELS
+  &shuffle_kernels_avx512vbmi,
+  &shuffle_kernels_avx2,
+  &shuffle_kernels_ssse3,
+#endif
+  &shuffle_kernels_scalar,
+  NULL,
+};
+
+const gather_kernels* const all_gather_kernels[] = {
+#ifdef HAVE_X86_SHUFFLE_KERNELS
+  &gather_kernels_avx512bw,
+  &gather_kernels_avx2,
+#endif
+  &gather_kernels_scalar,
+  NULL,
+};
+
+static const shuffle_kernels* selected_shuffle_kernels =
+    &shuffle_kernels_scalar;
+
+static const gather_kernels* selected_gather_kernels = &gather_kernels_scalar;
+
+#ifdef HAVE_X86_SHUFFLE_KERNELS
+// Selecting the implementations before main() runs avoids synchronization.
+__attribute__((constructor)) static void select_kernels(void) {
+  __builtin_cpu_init();
+  for (unsigned int i = 0; all_shuffle_kernels[i] != NULL; i++) {
+    if (all_shuffle_kernels[i]->is_supported()) {
+      selected_shuffle_kernels = all_shuffle_kernels[i];
+      break;
+    }
+  }
+  for (unsigned int i = 0; all_gather_kernels[i] != NULL; i++) {
+    if (all_gather_kernels[i]->is_supported()) {
+      selected_gather_kernels = all_gather_kernels[i];
+      break;
+    }
+  }
+}
+#endif
+
+const shuffle_kernels* get_shuffle_kernels(void) {
+  return selected_shuffle_kernels;
+}
+
+const gather_kernels* get_gather_kernels(void) {
+  return selected_gather_kernels;
+}
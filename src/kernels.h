@@ -0,0 +1,67 @@
+#include <stdint.h>
+
+// Permutations on domains of up to this size store one byte per point, larger
+// permutations store two bytes per point.
+#define MAX_DOMAIN_SMALL_REPR 255
+
+// Permutations on up to this many points fit into a single 64-byte vector.
+#define MAX_DOMAIN_SHUFFLE 64
+
+// Kernels operating on small permutations that are stored as one-based labels,
+// one byte per point. The product a * b applies a first, then b. Vectorized
+// implementations only accelerate domains of up to MAX_DOMAIN_SHUFFLE points,
+// but all implementations accept up to MAX_DOMAIN_SMALL_REPR points.
+typedef struct {
+  const char* name;
+  int (*is_supported)(void);
+  // dst = a * b, that is, dst[i] = b[a[i] - 1]. dst may alias a but not b.
+  void (*compose)(uint8_t* dst, const uint8_t* a, const uint8_t* b,
+                  unsigned int n);
+  // dst = a * b^-1. dst may alias a but not b.
+  void (*compose_inverse)(uint8_t* dst, const uint8_t* a, const uint8_t* b,
+                          unsigned int n);
+  // dst = a^-1 * b. dst must not alias a or b.
+  void (*inverse_compose)(uint8_t* dst, const uint8_t* a, const uint8_t* b,
+                          unsigned int n);
+  // dst = a^-1. dst must not alias a.
+  void (*inverse)(uint8_t* dst, const uint8_t* a, unsigned int n);
+  // dst = h^-1 * f * h. dst must not alias f or h.
+  void (*conjugate)(uint8_t* dst, const uint8_t* f, const uint8_t* h,
+                    unsigned int n);
+} shuffle_kernels;
+
+// All implementations, ordered by preference and terminated by NULL. The last
+// implementation is the portable reference, which is always supported.
+extern const shuffle_kernels* const all_shuffle_kernels[];
+
+// Returns the preferred implementation that is supported by the current CPU.
+const shuffle_kernels* get_shuffle_kernels(void);
+
+// Permutations on up to this many points are composed using blocked in-register
+// shuffles, larger ones using gathers.
+#define MAX_DOMAIN_BLOCKED_SHUFFLE 512
+
+// Permutations on up to this many points are accepted by the gather kernels,
+// some of which keep an inverse in a buffer of this size on the stack.
+#define MAX_DOMAIN_LARGE_REPR 1024
+
+// Kernels operating on large permutations that are stored as one-based labels,
+// two bytes per point. The semantics are the same as for shuffle_kernels. All
+// implementations accept up to MAX_DOMAIN_LARGE_REPR points.
+typedef struct {
+  const char* name;
+  int (*is_supported)(void);
+  void (*compose)(uint16_t* dst, const uint16_t* a, const uint16_t* b,
+                  unsigned int n);
+  void (*compose_inverse)(uint16_t* dst, const uint16_t* a, const uint16_t* b,
+                          unsigned int n);
+  void (*inverse_compose)(uint16_t* dst, const uint16_t* a, const uint16_t* b,
+                          unsigned int n);
+  void (*inverse)(uint16_t* dst, const uint16_t* a, unsigned int n);
+  void (*conjugate)(uint16_t* dst, const uint16_t* f, const uint16_t* h,
+                    unsigned int n);
+} gather_kernels;
+
+extern const gather_kernels* const all_gather_kernels[];
+
+const gather_kernels* get_gather_kernels(void);
@@ -0,0 +1,467 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <zkp-volte-patarin-nachef/protocol.h>
+
+#include "internals.h"
+
+// The number of entries that are sampled when one of them has to be evicted.
+// The least recently used one among them is evicted, which approximates LRU
+// eviction without updating a shared list on each lookup.
+#define EVICTION_SAMPLES 8
+
+// Lookups never take a lock. Each thread announces its lookups in one of
+// several reader slots, which occupy separate cache lines, such that lookups
+// from multiple threads only write to shared memory when they find the same
+// entry. Insertions and evictions are serialized by a mutex, publish changes
+// of the hash chains with release stores, and only release an evicted entry
+// once all lookups that might still see it have finished, see
+// wait_for_readers.
+#define N_READER_SLOTS 64
+
+typedef struct {
+  // The number of lookups in progress, for each parity of the reader epoch.
+  unsigned long readers[2];
+  unsigned long long hits;
+  unsigned char padding[CACHE_LINE_SIZE - 2 * sizeof(unsigned long) -
+                        sizeof(unsigned long long)];
+} reader_slot;
+
+#ifndef __WASM__
+#include <sched.h>
+
+typedef pthread_mutex_t cache_lock;
+
+static int init_cache_lock(cache_lock* lock) {
+  return pthread_mutex_init(lock, NULL) == 0;
+}
+
+static void destroy_cache_lock(cache_lock* lock) {
+  pthread_mutex_destroy(lock);
+}
+
+static void lock(cache_lock* lock) {
+  int ret = pthread_mutex_lock(lock);
+  assert(ret == 0);
+  (void) ret;
+}
+
+static void unlock(cache_lock* lock) {
+  int ret = pthread_mutex_unlock(lock);
+  assert(ret == 0);
+  (void) ret;
+}
+
+static unsigned int next_reader_slot = 0;
+static __thread unsigned int thread_reader_slot = N_READER_SLOTS;
+
+// Threads are assigned to slots round-robin on their first lookup.
+static unsigned int get_reader_slot(void) {
+  if (thread_reader_slot == N_READER_SLOTS) {
+    thread_reader_slot =
+        __atomic_fetch_add(&next_reader_slot, 1, __ATOMIC_RELAXED) %
+        N_READER_SLOTS;
+  }
+  return thread_reader_slot;
+}
+
+static void yield_to_readers(void) {
+  sched_yield();
+}
+#else
+typedef int cache_lock;
+
+static int init_cache_lock(cache_lock* lock) {
+  (void) lock;
+  return 1;
+}
+
+static void destroy_cache_lock(cache_lock* lock) {
+  (void) lock;
+}
+
+static void lock(cache_lock* lock) {
+  (void) lock;
+}
+
+static void unlock(cache_lock* lock) {
+  (void) lock;
+}
+
+static unsigned int get_reader_slot(void) {
+  return 0;
+}
+
+static void yield_to_readers(void) {}
+#endif
+
+struct cached_public_key_s {
+  uint64_t hash;
+  unsigned char* key_material;
+  const zkp_public_key* key;
+  // One reference is held by the cache while the entry is in the table, and one
+  // by each verification that uses the key. The last one frees the entry.
+  unsigned int refs;
+  uint64_t last_used;
+  // A verification that has been freed, which is reused by the next one.
+  zkp_verification* idle;
+  cached_public_key* next;
+  // The position of the entry in the entries array of the cache.
+  unsigned int position;
+};
+
+struct zkp_public_key_cache_s {
+  const zkp_params* params;
+  unsigned int key_size;
+  size_t entry_size;
+  uint64_t seed;
+  // Held by insertions and evictions, but not by lookups.
+  cache_lock lock;
+  // Hash table with chaining, which has at least as many buckets as the cache
+  // has room for entries. Lookups traverse the chains concurrently with
+  // changes.
+  cached_public_key** buckets;
+  uint32_t bucket_mask;
+  // All entries in no particular order, for sampling them during eviction.
+  cached_public_key** entries;
+  unsigned int n_entries;
+  unsigned int max_entries;
+  // Advanced by each insertion only, such that lookups merely read it. Entries
+  // are thus ordered by the last insertion before their last use.
+  uint64_t clock;
+  uint64_t sampler;
+  unsigned int reader_epoch;
+  reader_slot* reader_slots;
+  void* reader_slots_storage;
+  unsigned long long misses;
+  unsigned long long evictions;
+};
+
+// Estimates the memory that is used by an entry, including its public key and
+// one verification.
+static size_t estimate_entry_size(const zkp_params* params,
+                                  unsigned int key_size) {
+  const size_t mapping_size = permutation_mapping_size(params->domain);
+  size_t size = sizeof(cached_public_key) + key_size + sizeof(zkp_public_key) +
+                mapping_size + sizeof(zkp_verification) +
+                (N_SCRATCH_PERMUTATIONS + 2) * mapping_size +
+                (params->d + 2) * COMMITMENT_SIZE;
+  // The share of the entry in the hash table, which has fewer than twice as
+  // many buckets as the cache has room for entries, and in the entry list.
+  size += 3 * sizeof(cached_public_key*);
+  if (params->conjugates != NULL) {
+    size += permutation_array_alloc_size(params->domain, params->H.count);
+  }
+  return size;
+}
+
+// The hash is seeded randomly for each cache, such that the distribution of
+// keys among buckets cannot be predicted by whoever chooses the keys.
+static uint64_t hash_key_material(const zkp_public_key_cache* cache,
+                                  const unsigned char* key_material) {
+  uint64_t h = cache->seed;
+  unsigned int i = 0;
+  for (; i + sizeof(uint64_t) <= cache->key_size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, key_material + i, sizeof(word));
+    h = (h ^ word) * UINT64_C(0x9e3779b97f4a7c15);
+    h ^= h >> 32;
+  }
+  for (; i < cache->key_size; i++) {
+    h = (h ^ key_material[i]) * UINT64_C(0x9e3779b97f4a7c15);
+    h ^= h >> 32;
+  }
+  return h;
+}
+
+zkp_public_key_cache* zkp_new_public_key_cache(const zkp_params* params,
+                                               size_t memory_budget) {
+  const unsigned int key_size = zkp_get_public_key_size(params);
+  const size_t entry_size = estimate_entry_size(params, key_size);
+  const size_t max_entries = memory_budget / entry_size;
+  if (max_entries == 0 || max_entries > UINT32_MAX / 2) {
+    return NULL;
+  }
+
+  zkp_public_key_cache* cache = malloc(sizeof(zkp_public_key_cache));
+  if (cache == NULL) {
+    return NULL;
+  }
+  uint32_t n_buckets = 1;
+  while (n_buckets < max_entries) {
+    n_buckets *= 2;
+  }
+  cache->buckets = calloc(n_buckets, sizeof(cached_public_key*));
+  cache->entries = malloc(max_entries * sizeof(cached_public_key*));
+  cache->reader_slots_storage =
+      calloc(1, N_READER_SLOTS * sizeof(reader_slot) + CACHE_LINE_SIZE);
+  if (cache->buckets == NULL || cache->entries == NULL ||
+      cache->reader_slots_storage == NULL || !init_cache_lock(&cache->lock)) {
+    free(cache->buckets);
+    free(cache->entries);
+    free(cache->reader_slots_storage);
+    free(cache);
+    return NULL;
+  }
+  cache->reader_slots = align_to_cache_line(cache->reader_slots_storage);
+  cache->reader_epoch = 0;
+
+  cache->params = params;
+  cache->key_size = key_size;
+  cache->entry_size = entry_size;
+  memset_random(&cache->seed, sizeof(cache->seed));
+  cache->bucket_mask = n_buckets - 1;
+  cache->n_entries = 0;
+  cache->max_entries = (unsigned int) max_entries;
+  cache->clock = 0;
+  cache->sampler = cache->seed;
+  cache->misses = 0;
+  cache->evictions = 0;
+  return cache;
+}
+
+static void free_entry(cached_public_key* entry) {
+  if (entry->idle != NULL) {
+    entry->idle->cache_entry = NULL;
+    zkp_free_verification(entry->idle);
+  }
+  zkp_free_public_key(entry->key);
+  free(entry->key_material);
+  free(entry);
+}
+
+static void release_entry(cached_public_key* entry) {
+  if (__atomic_sub_fetch(&entry->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+    free_entry(entry);
+  }
+}
+
+// Returns the entry for the given key material with an additional reference,
+// or NULL if there is none. Must be called by a lookup, see lookup_entry, or
+// with the lock held.
+static cached_public_key* find_entry(zkp_public_key_cache* cache, uint64_t hash,
+                                     const unsigned char* key_material) {
+  cached_public_key* entry = __atomic_load_n(
+      &cache->buckets[hash & cache->bucket_mask], __ATOMIC_ACQUIRE);
+  for (; entry != NULL;
+       entry = __atomic_load_n(&entry->next, __ATOMIC_ACQUIRE)) {
+    if (entry->hash == hash &&
+        memcmp(entry->key_material, key_material, cache->key_size) == 0) {
+      __atomic_add_fetch(&entry->refs, 1, __ATOMIC_RELAXED);
+      // Hot entries are not written to again until the next insertion.
+      const uint64_t now = __atomic_load_n(&cache->clock, __ATOMIC_RELAXED);
+      if (__atomic_load_n(&entry->last_used, __ATOMIC_RELAXED) != now) {
+        __atomic_store_n(&entry->last_used, now, __ATOMIC_RELAXED);
+      }
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+// Finds an entry without taking the lock. The lookup is announced in the
+// reader slot of the thread while it traverses the table, under the parity of
+// the reader epoch that it observed at its start, which may be outdated by the
+// time it announces itself.
+static cached_public_key* lookup_entry(zkp_public_key_cache* cache,
+                                       uint64_t hash,
+                                       const unsigned char* key_material) {
+  reader_slot* slot = &cache->reader_slots[get_reader_slot()];
+  const unsigned int parity =
+      __atomic_load_n(&cache->reader_epoch, __ATOMIC_RELAXED) & 1;
+  __atomic_add_fetch(&slot->readers[parity], 1, __ATOMIC_RELAXED);
+  // Either wait_for_readers sees the announcement, under whichever parity, or
+  // the lookup sees all changes of the table that precede the wait.
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  cached_public_key* entry = find_entry(cache, hash, key_material);
+  __atomic_sub_fetch(&slot->readers[parity], 1, __ATOMIC_RELEASE);
+  if (entry != NULL) {
+    __atomic_add_fetch(&slot->hits, 1, __ATOMIC_RELAXED);
+  }
+  return entry;
+}
+
+// Waits until all lookups that may have seen the table before the preceding
+// changes have finished. Since a lookup may announce itself under an outdated
+// parity, both parities are drained, one after the other. The epoch is
+// advanced before each, such that lookups that start in the meantime are
+// announced under the other parity and cannot delay the wait indefinitely.
+// The lock must be held.
+static void wait_for_readers(zkp_public_key_cache* cache) {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  for (unsigned int phase = 0; phase < 2; phase++) {
+    const unsigned int parity =
+        __atomic_fetch_add(&cache->reader_epoch, 1, __ATOMIC_RELAXED) & 1;
+    for (unsigned int i = 0; i < N_READER_SLOTS; i++) {
+      while (__atomic_load_n(&cache->reader_slots[i].readers[parity],
+                             __ATOMIC_ACQUIRE) != 0) {
+        yield_to_readers();
+      }
+    }
+  }
+}
+
+// Removes an entry from the table, but does not release the reference of the
+// table. The lock must be held.
+static void unlink_entry(zkp_public_key_cache* cache,
+                         cached_public_key* entry) {
+  cached_public_key** link = &cache->buckets[entry->hash & cache->bucket_mask];
+  while (*link != entry) {
+    link = &(*link)->next;
+  }
+  __atomic_store_n(link, entry->next, __ATOMIC_RELEASE);
+  cached_public_key* last = cache->entries[--cache->n_entries];
+  cache->entries[entry->position] = last;
+  last->position = entry->position;
+}
+
+// Evicts the least recently used of a few randomly sampled entries, once no
+// lookup can find it anymore. The lock must be held.
+static void evict_entry(zkp_public_key_cache* cache) {
+  cached_public_key* victim = NULL;
+  for (unsigned int i = 0; i < EVICTION_SAMPLES; i++) {
+    cache->sampler = (cache->sampler ^ (cache->sampler >> 31)) *
+                         UINT64_C(0x9e3779b97f4a7c15) +
+                     1;
+    cached_public_key* entry =
+        cache->entries[(cache->sampler >> 32) % cache->n_entries];
+    if (victim == NULL ||
+        __atomic_load_n(&entry->last_used, __ATOMIC_RELAXED) <
+            __atomic_load_n(&victim->last_used, __ATOMIC_RELAXED)) {
+      victim = entry;
+    }
+  }
+  unlink_entry(cache, victim);
+  wait_for_readers(cache);
+  release_entry(victim);
+  __atomic_add_fetch(&cache->evictions, 1, __ATOMIC_RELAXED);
+}
+
+// Imports and prepares the public key outside of the lock, and then inserts it,
+// unless another thread has inserted the same key in the meantime.
+static cached_public_key* insert_entry(zkp_public_key_cache* cache,
+                                       uint64_t hash,
+                                       const unsigned char* key_material) {
+  cached_public_key* entry = malloc(sizeof(cached_public_key));
+  if (entry == NULL) {
+    return NULL;
+  }
+  entry->key_material = malloc(cache->key_size);
+  if (entry->key_material == NULL) {
+    free(entry);
+    return NULL;
+  }
+  memcpy(entry->key_material, key_material, cache->key_size);
+  entry->key = zkp_import_public_key(cache->params, key_material);
+  if (entry->key == NULL || !zkp_prepare_public_key(entry->key)) {
+    if (entry->key != NULL) {
+      zkp_free_public_key(entry->key);
+    }
+    free(entry->key_material);
+    free(entry);
+    return NULL;
+  }
+  entry->hash = hash;
+  // One reference for the table and one for the caller.
+  entry->refs = 2;
+  entry->idle = NULL;
+
+  lock(&cache->lock);
+  cached_public_key* existing = find_entry(cache, hash, key_material);
+  if (existing == NULL) {
+    if (cache->n_entries == cache->max_entries) {
+      evict_entry(cache);
+    }
+    entry->last_used = __atomic_fetch_add(&cache->clock, 1, __ATOMIC_RELAXED);
+    cached_public_key** bucket = &cache->buckets[hash & cache->bucket_mask];
+    entry->next = *bucket;
+    __atomic_store_n(bucket, entry, __ATOMIC_RELEASE);
+    entry->position = cache->n_entries;
+    cache->entries[cache->n_entries++] = entry;
+  }
+  unlock(&cache->lock);
+
+  if (existing != NULL) {
+    free_entry(entry);
+    return existing;
+  }
+  return entry;
+}
+
+zkp_verification* zkp_new_cached_verification(
+    zkp_public_key_cache* cache, const unsigned char* key_material) {
+  const uint64_t hash = hash_key_material(cache, key_material);
+
+  cached_public_key* entry = lookup_entry(cache, hash, key_material);
+  if (entry == NULL) {
+    __atomic_add_fetch(&cache->misses, 1, __ATOMIC_RELAXED);
+    entry = insert_entry(cache, hash, key_material);
+    if (entry == NULL) {
+      return NULL;
+    }
+  }
+
+  zkp_verification* verification =
+      __atomic_exchange_n(&entry->idle, NULL, __ATOMIC_ACQUIRE);
+  if (verification != NULL) {
+    verification->q = Q_NONE;
+    verification->n_successful_rounds = 0;
+    if (verification->commitment.scheme != cache->params->commitment) {
+      init_commitment_engine(&verification->commitment,
+                             cache->params->commitment);
+    }
+  } else {
+    verification = zkp_new_verification(entry->key);
+    if (verification == NULL) {
+      release_entry(entry);
+      return NULL;
+    }
+    verification->cache_entry = entry;
+  }
+  return verification;
+}
+
+int release_cached_verification(zkp_verification* verification) {
+  cached_public_key* entry = verification->cache_entry;
+  zkp_verification* expected = NULL;
+  // Seeded verifications are never reused, since their questions would be
+  // predictable.
+  const int kept = verification->rng == NULL &&
+                   __atomic_compare_exchange_n(&entry->idle, &expected,
+                                               verification, 0,
+                                               __ATOMIC_RELEASE,
+                                               __ATOMIC_RELAXED);
+  if (!kept) {
+    verification->cache_entry = NULL;
+  }
+  release_entry(entry);
+  return kept;
+}
+
+void zkp_get_public_key_cache_stats(zkp_public_key_cache* cache,
+                                    zkp_public_key_cache_stats* stats) {
+  lock(&cache->lock);
+  stats->n_keys = cache->n_entries;
+  unlock(&cache->lock);
+  stats->memory_used = stats->n_keys * cache->entry_size;
+  stats->hits = 0;
+  for (unsigned int i = 0; i < N_READER_SLOTS; i++) {
+    stats->hits +=
+        __atomic_load_n(&cache->reader_slots[i].hits, __ATOMIC_RELAXED);
+  }
+  stats->misses = __atomic_load_n(&cache->misses, __ATOMIC_RELAXED);
+  stats->evictions = __atomic_load_n(&cache->evictions, __ATOMIC_RELAXED);
+}
+
+void zkp_free_public_key_cache(zkp_public_key_cache* cache) {
+  // No lookups can be in progress anymore.
+  while (cache->n_entries != 0) {
+    cached_public_key* entry = cache->entries[cache->n_entries - 1];
+    unlink_entry(cache, entry);
+    release_entry(entry);
+  }
+  destroy_cache_lock(&cache->lock);
+  free(cache->buckets);
+  free(cache->entries);
+  free(cache->reader_slots_storage);
+  free(cache);
+}
@@ -0,0 +1,139 @@
+#include <zkp-volte-patarin-nachef/params.h>
+
+#include "internals.h"
+
+// Upper bound for the number of threads that compute tables.
+#define MAX_INIT_THREADS 64
+
+// Accessed atomically, since a parameter set may be initialized by another
+// thread while zkp_params_preload runs. Such an initialization uses either
+// thread count.
+static unsigned int n_init_threads = 1;
+
+void zkp_params_preload(unsigned int n_threads) {
+  __atomic_store_n(&n_init_threads, n_threads == 0 ? 1 : n_threads,
+                   __ATOMIC_RELAXED);
+  zkp_params_3x3x3();
+  zkp_params_5x5x5();
+  zkp_params_s41();
+  zkp_params_s41ast();
+  zkp_params_s43ast();
+  zkp_params_s53ast();
+}
+
+typedef struct {
+  const permutation_array* dst;
+  const permutation_array* src;
+  // The stored powers of h, if dst is F.
+  const permutation_array* h_table;
+  unsigned int begin;
+  unsigned int end;
+} fill_job;
+
+// Computes only the first power of h directly. The others follow from it by
+// one composition each, and each F[k] by one conjugation by H[k], which is
+// much faster than computing them from the cycles of h.
+static void* fill_rows(void* arg) {
+  const fill_job* job = arg;
+  if (job->begin == job->end) {
+    return NULL;
+  }
+  if (job->h_table != NULL) {
+    const permutation* f = job->src->implicit->f;
+    for (unsigned int k = job->begin; k < job->end; k++) {
+      permutation row = permutation_array_element(job->dst, k);
+      conjugate_permutation_by_array(&row, f, job->h_table, k);
+    }
+    return NULL;
+  }
+  STACK_ALLOC_PERMUTATION(h, job->src->domain);
+  compute_permutation_in_array(&h, job->src, 1 % job->src->count);
+  permutation prev = permutation_array_element(job->dst, job->begin);
+  compute_permutation_in_array(&prev, job->src, job->begin);
+  for (unsigned int k = job->begin + 1; k < job->end; k++) {
+    permutation row = permutation_array_element(job->dst, k);
+    compose_permutations(&row, &prev, &h);
+    prev = row;
+  }
+  return NULL;
+}
+
+// Stores all permutations of the implicit array src in the writable storage of
+// dst, where h_table must hold the powers of h if src is F. Since each range of
+// permutations can be computed independently, and each permutation occupies
+// whole cache lines, the array is simply split between threads.
+static void fill_permutation_array(const permutation_array* dst,
+                                   const permutation_array* src,
+                                   const permutation_array* h_table,
+                                   unsigned int n_threads) {
+  if (n_threads > MAX_INIT_THREADS) {
+    n_threads = MAX_INIT_THREADS;
+  }
+  if (n_threads > src->count) {
+    n_threads = src->count;
+  }
+  fill_job jobs[MAX_INIT_THREADS];
+  for (unsigned int t = 0; t < n_threads; t++) {
+    jobs[t].dst = dst;
+    jobs[t].src = src;
+    jobs[t].h_table = h_table;
+    jobs[t].begin = (unsigned int) ((uint64_t) src->count * t / n_threads);
+    jobs[t].end = (unsigned int) ((uint64_t) src->count * (t + 1) / n_threads);
+  }
+
+#ifndef __WASM__
+  // The calling thread takes the first range. If a thread cannot be created,
+  // the calling thread takes its range, too.
+  pthread_t threads[MAX_INIT_THREADS];
+  int started[MAX_INIT_THREADS] = { 0 };
+  for (unsigned int t = 1; t < n_threads; t++) {
+    started[t] = pthread_create(&threads[t], NULL, fill_rows, &jobs[t]) == 0;
+  }
+  for (unsigned int t = 0; t < n_threads; t++) {
+    if (!started[t]) {
+      fill_rows(&jobs[t]);
+    }
+  }
+  for (unsigned int t = 1; t < n_threads; t++) {
+    if (started[t]) {
+      pthread_join(threads[t], NULL);
+    }
+  }
+#else
+  for (unsigned int t = 0; t < n_threads; t++) {
+    fill_rows(&jobs[t]);
+  }
+#endif
+}
+
+void materialize_params_tables(zkp_params* params, const char* name) {
+  permutation_array h = params->H, f = params->F;
+  h.implicit = NULL;
+  f.implicit = NULL;
+  permutation_array* const arrays[] = { &h, &f };
+  if (!map_cached_permutation_arrays(name, arrays, 2)) {
+    void* h_base = alloc_permutation_array_base(h.domain, h.count);
+    void* f_base = alloc_permutation_array_base(f.domain, f.count);
+    assert(h_base != NULL && f_base != NULL);
+    if (PERMUTATION_IS_SMALL(&h)) {
+      h.base.small = h_base;
+      f.base.small = f_base;
+    } else {
+      h.base.large = h_base;
+      f.base.large = f_base;
+    }
+    const unsigned int n_threads =
+        __atomic_load_n(&n_init_threads, __ATOMIC_RELAXED);
+    fill_permutation_array(&h, &params->H, NULL, n_threads);
+    fill_permutation_array(&f, &params->F, &h, n_threads);
+
+    int indexed = index_permutation_array(&f);
+    assert(indexed);
+    (void) indexed;
+
+    // The tables remain usable if they cannot be cached.
+    write_cached_permutation_arrays(name, arrays, 2);
+  }
+  params->H = h;
+  params->F = f;
+}
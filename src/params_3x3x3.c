@@ -1,127 +1,156 @@
+#include <stdlib.h>
+
 #include <zkp-volte-patarin-nachef/params.h>
 
 #include "internals.h"
 
 // clang-format off
 
-#define PARAMS_3X3X3_F_INTERLEAVED \
-   3, 17,  1,  1, 14,  1,  \
-   5,  2,  2,  2, 12,  2,  \
-   8,  3,  3, 38,  9,  3,  \
-   2, 20,  4,  4,  4,  4,  \
-   7,  5,  5, 36,  5,  5,  \
-   1, 22, 25,  6,  6,  6,  \
-   4,  7, 28,  7,  7,  7,  \
-   6,  8, 30, 33,  8,  8,  \
-  33, 11,  9,  9, 46,  9,  \
-  34, 13, 10, 10, 10, 10,  \
-  35, 16,  8, 11, 11, 11,  \
-  12, 10, 12, 12, 47, 12,  \
-  13, 15,  7, 13, 13, 13,  \
-  14,  9, 14, 14, 48, 22,  \
-  15, 12, 15, 15, 15, 23,  \
-  16, 14,  6, 16, 16, 24,  \
-   9, 41, 19, 17, 17, 17,  \
-  10, 18, 21, 18, 18, 18,  \
-  11, 19, 24,  3, 19, 19,  \
-  20, 44, 18, 20, 20, 20,  \
-  21, 21, 23,  5, 21, 21,  \
-  22, 46, 17, 22, 22, 30,  \
-  23, 23, 20, 23, 23, 31,  \
-  24, 24, 22,  8, 24, 32,  \
-  17, 25, 43, 27, 25, 25,  \
-  18, 26, 26, 29, 26, 26,  \
-  19, 27, 27, 32,  1, 27,  \
-  28, 28, 42, 26, 28, 28,  \
-  29, 29, 29, 31,  2, 29,  \
-  30, 30, 41, 25, 30, 38,  \
-  31, 31, 31, 28, 31, 39,  \
-  32, 32, 32, 30,  3, 40,  \
-  25, 33, 33, 48, 35, 33,  \
-  26, 34, 34, 34, 37, 34,  \
-  27,  6, 35, 35, 40, 35,  \
-  36, 36, 36, 45, 34, 36,  \
-  37,  4, 37, 37, 39, 37,  \
-  38, 38, 38, 43, 33, 14,  \
-  39, 39, 39, 39, 36, 15,  \
-  40,  1, 40, 40, 38, 16,  \
-  41, 40, 11, 41, 41, 43,  \
-  42, 42, 13, 42, 42, 45,  \
-  43, 43, 16, 19, 43, 48,  \
-  44, 37, 44, 44, 44, 42,  \
-  45, 45, 45, 21, 45, 47,  \
-  46, 35, 46, 46, 32, 41,  \
-  47, 47, 47, 47, 29, 44,  \
-  48, 48, 48, 24, 27, 46   \
-
-#define PARAMS_3X3X3_H_INTERLEAVED \
-   1,  8, 48, 41, 22, 19, 35, 38, 32, 25, 16,  9,  6,  3, 46, 43, 30, 27, 11, 14, 40, 33, 24, 17,  \
-   2,  7, 47, 42, 20, 21, 37, 36, 31, 26, 15, 10,  4,  5, 44, 45, 28, 29, 13, 12, 39, 34, 23, 18,  \
-   3,  6, 46, 43, 17, 24, 40, 33, 30, 27, 14, 11,  1,  8, 41, 48, 25, 32, 16,  9, 38, 35, 22, 19,  \
-   4,  5, 45, 44, 23, 18, 34, 39, 29, 28, 13, 12,  7,  2, 47, 42, 31, 26, 10, 15, 37, 36, 21, 20,  \
-   5,  4, 44, 45, 18, 23, 39, 34, 28, 29, 12, 13,  2,  7, 42, 47, 26, 31, 15, 10, 36, 37, 20, 21,  \
-   6,  3, 43, 46, 24, 17, 33, 40, 27, 30, 11, 14,  8,  1, 48, 41, 32, 25,  9, 16, 35, 38, 19, 22,  \
-   7,  2, 42, 47, 21, 20, 36, 37, 26, 31, 10, 15,  5,  4, 45, 44, 29, 28, 12, 13, 34, 39, 18, 23,  \
-   8,  1, 41, 48, 19, 22, 38, 35, 25, 32,  9, 16,  3,  6, 43, 46, 27, 30, 14, 11, 33, 40, 17, 24,  \
-   9, 25, 32, 16, 41,  8,  1, 48, 38, 19, 22, 35, 17, 33, 40, 24, 43,  3,  6, 46, 14, 27, 30, 11,  \
-  10, 26, 31, 15, 42,  7,  2, 47, 36, 21, 20, 37, 18, 34, 39, 23, 45,  5,  4, 44, 12, 29, 28, 13,  \
-  11, 27, 30, 14, 43,  6,  3, 46, 33, 24, 17, 40, 19, 35, 38, 22, 48,  8,  1, 41,  9, 32, 25, 16,  \
-  12, 28, 29, 13, 44,  5,  4, 45, 39, 18, 23, 34, 20, 36, 37, 21, 42,  2,  7, 47, 15, 26, 31, 10,  \
-  13, 29, 28, 12, 45,  4,  5, 44, 34, 23, 18, 39, 21, 37, 36, 20, 47,  7,  2, 42, 10, 31, 26, 15,  \
-  14, 30, 27, 11, 46,  3,  6, 43, 40, 17, 24, 33, 22, 38, 35, 19, 41,  1,  8, 48, 16, 25, 32,  9,  \
-  15, 31, 26, 10, 47,  2,  7, 42, 37, 20, 21, 36, 23, 39, 34, 18, 44,  4,  5, 45, 13, 28, 29, 12,  \
-  16, 32, 25,  9, 48,  1,  8, 41, 35, 22, 19, 38, 24, 40, 33, 17, 46,  6,  3, 43, 11, 30, 27, 14,  \
-  17, 33, 24, 40, 30, 11, 27, 14,  3, 43,  6, 46, 25,  9, 32, 16, 38, 19, 35, 22,  1, 48,  8, 41,  \
-  18, 34, 23, 39, 28, 13, 29, 12,  5, 45,  4, 44, 26, 10, 31, 15, 36, 21, 37, 20,  2, 47,  7, 42,  \
-  19, 35, 22, 38, 25, 16, 32,  9,  8, 48,  1, 41, 27, 11, 30, 14, 33, 24, 40, 17,  3, 46,  6, 43,  \
-  20, 36, 21, 37, 31, 10, 26, 15,  2, 42,  7, 47, 28, 12, 29, 13, 39, 18, 34, 23,  4, 45,  5, 44,  \
-  21, 37, 20, 36, 26, 15, 31, 10,  7, 47,  2, 42, 29, 13, 28, 12, 34, 23, 39, 18,  5, 44,  4, 45,  \
-  22, 38, 19, 35, 32,  9, 25, 16,  1, 41,  8, 48, 30, 14, 27, 11, 40, 17, 33, 24,  6, 43,  3, 46,  \
-  23, 39, 18, 34, 29, 12, 28, 13,  4, 44,  5, 45, 31, 15, 26, 10, 37, 20, 36, 21,  7, 42,  2, 47,  \
-  24, 40, 17, 33, 27, 14, 30, 11,  6, 46,  3, 43, 32, 16, 25,  9, 35, 22, 38, 19,  8, 41,  1, 48,  \
-  25,  9, 16, 32,  8, 41, 48,  1, 19, 38, 35, 22, 33, 17, 24, 40,  3, 43, 46,  6, 27, 14, 11, 30,  \
-  26, 10, 15, 31,  7, 42, 47,  2, 21, 36, 37, 20, 34, 18, 23, 39,  5, 45, 44,  4, 29, 12, 13, 28,  \
-  27, 11, 14, 30,  6, 43, 46,  3, 24, 33, 40, 17, 35, 19, 22, 38,  8, 48, 41,  1, 32,  9, 16, 25,  \
-  28, 12, 13, 29,  5, 44, 45,  4, 18, 39, 34, 23, 36, 20, 21, 37,  2, 42, 47,  7, 26, 15, 10, 31,  \
-  29, 13, 12, 28,  4, 45, 44,  5, 23, 34, 39, 18, 37, 21, 20, 36,  7, 47, 42,  2, 31, 10, 15, 26,  \
-  30, 14, 11, 27,  3, 46, 43,  6, 17, 40, 33, 24, 38, 22, 19, 35,  1, 41, 48,  8, 25, 16,  9, 32,  \
-  31, 15, 10, 26,  2, 47, 42,  7, 20, 37, 36, 21, 39, 23, 18, 34,  4, 44, 45,  5, 28, 13, 12, 29,  \
-  32, 16,  9, 25,  1, 48, 41,  8, 22, 35, 38, 19, 40, 24, 17, 33,  6, 46, 43,  3, 30, 11, 14, 27,  \
-  33, 17, 40, 24, 11, 30, 14, 27, 43,  3, 46,  6,  9, 25, 16, 32, 19, 38, 22, 35, 48,  1, 41,  8,  \
-  34, 18, 39, 23, 13, 28, 12, 29, 45,  5, 44,  4, 10, 26, 15, 31, 21, 36, 20, 37, 47,  2, 42,  7,  \
-  35, 19, 38, 22, 16, 25,  9, 32, 48,  8, 41,  1, 11, 27, 14, 30, 24, 33, 17, 40, 46,  3, 43,  6,  \
-  36, 20, 37, 21, 10, 31, 15, 26, 42,  2, 47,  7, 12, 28, 13, 29, 18, 39, 23, 34, 45,  4, 44,  5,  \
-  37, 21, 36, 20, 15, 26, 10, 31, 47,  7, 42,  2, 13, 29, 12, 28, 23, 34, 18, 39, 44,  5, 45,  4,  \
-  38, 22, 35, 19,  9, 32, 16, 25, 41,  1, 48,  8, 14, 30, 11, 27, 17, 40, 24, 33, 43,  6, 46,  3,  \
-  39, 23, 34, 18, 12, 29, 13, 28, 44,  4, 45,  5, 15, 31, 10, 26, 20, 37, 21, 36, 42,  7, 47,  2,  \
-  40, 24, 33, 17, 14, 27, 11, 30, 46,  6, 43,  3, 16, 32,  9, 25, 22, 35, 19, 38, 41,  8, 48,  1,  \
-  41, 48,  8,  1, 38, 35, 19, 22,  9, 16, 25, 32, 43, 46,  3,  6, 14, 11, 27, 30, 17, 24, 33, 40,  \
-  42, 47,  7,  2, 36, 37, 21, 20, 10, 15, 26, 31, 45, 44,  5,  4, 12, 13, 29, 28, 18, 23, 34, 39,  \
-  43, 46,  6,  3, 33, 40, 24, 17, 11, 14, 27, 30, 48, 41,  8,  1,  9, 16, 32, 25, 19, 22, 35, 38,  \
-  44, 45,  5,  4, 39, 34, 18, 23, 12, 13, 28, 29, 42, 47,  2,  7, 15, 10, 26, 31, 20, 21, 36, 37,  \
-  45, 44,  4,  5, 34, 39, 23, 18, 13, 12, 29, 28, 47, 42,  7,  2, 10, 15, 31, 26, 21, 20, 37, 36,  \
-  46, 43,  3,  6, 40, 33, 17, 24, 14, 11, 30, 27, 41, 48,  1,  8, 16,  9, 25, 32, 22, 19, 38, 35,  \
-  47, 42,  2,  7, 37, 36, 20, 21, 15, 10, 31, 26, 44, 45,  4,  5, 13, 12, 28, 29, 23, 18, 39, 34,  \
-  48, 41,  1,  8, 35, 38, 22, 19, 16,  9, 32, 25, 46, 43,  6,  3, 11, 14, 30, 27, 24, 17, 40, 33
+#define PARAMS_3X3X3_F \
+  {  3,  5,  8,  2,  7,  1,  4,  6, 33, 34, 35, 12, 13, 14, 15, 16,  9, 10, 11, 20, 21, 22, 23, 24,    \
+    17, 18, 19, 28, 29, 30, 31, 32, 25, 26, 27, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48 },  \
+  { 17,  2,  3, 20,  5, 22,  7,  8, 11, 13, 16, 10, 15,  9, 12, 14, 41, 18, 19, 44, 21, 46, 23, 24,    \
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34,  6, 36,  4, 38, 39,  1, 40, 42, 43, 37, 45, 35, 47, 48 },  \
+  {  1,  2,  3,  4,  5, 25, 28, 30,  9, 10,  8, 12,  7, 14, 15,  6, 19, 21, 24, 18, 23, 17, 20, 22,    \
+    43, 26, 27, 42, 29, 41, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 11, 13, 16, 44, 45, 46, 47, 48 },  \
+  {  1,  2, 38,  4, 36,  6,  7, 33,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18,  3, 20,  5, 22, 23,  8,    \
+    27, 29, 32, 26, 31, 25, 28, 30, 48, 34, 35, 45, 37, 43, 39, 40, 41, 42, 19, 44, 21, 46, 47, 24 },  \
+  { 14, 12,  9,  4,  5,  6,  7,  8, 46, 10, 11, 47, 13, 48, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,    \
+    25, 26,  1, 28,  2, 30, 31,  3, 35, 37, 40, 34, 39, 33, 36, 38, 41, 42, 43, 44, 45, 32, 29, 27 },  \
+  {  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 22, 23, 24, 17, 18, 19, 20, 21, 30, 31, 32,    \
+    25, 26, 27, 28, 29, 38, 39, 40, 33, 34, 35, 36, 37, 14, 15, 16, 43, 45, 48, 42, 47, 41, 44, 46 }
+
+#define PARAMS_3X3X3_H \
+  {  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,    \
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48 },  \
+  {  8,  7,  6,  5,  4,  3,  2,  1, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,    \
+     9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 48, 47, 46, 45, 44, 43, 42, 41 },  \
+  { 48, 47, 46, 45, 44, 43, 42, 41, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,    \
+    16, 15, 14, 13, 12, 11, 10,  9, 40, 39, 38, 37, 36, 35, 34, 33,  8,  7,  6,  5,  4,  3,  2,  1 },  \
+  { 41, 42, 43, 44, 45, 46, 47, 48, 16, 15, 14, 13, 12, 11, 10,  9, 40, 39, 38, 37, 36, 35, 34, 33,    \
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,  1,  2,  3,  4,  5,  6,  7,  8 },  \
+  { 22, 20, 17, 23, 18, 24, 21, 19, 41, 42, 43, 44, 45, 46, 47, 48, 30, 28, 25, 31, 26, 32, 29, 27,    \
+     8,  7,  6,  5,  4,  3,  2,  1, 11, 13, 16, 10, 15,  9, 12, 14, 38, 36, 33, 39, 34, 40, 37, 35 },  \
+  { 19, 21, 24, 18, 23, 17, 20, 22,  8,  7,  6,  5,  4,  3,  2,  1, 11, 13, 16, 10, 15,  9, 12, 14,    \
+    41, 42, 43, 44, 45, 46, 47, 48, 30, 28, 25, 31, 26, 32, 29, 27, 35, 37, 40, 34, 39, 33, 36, 38 },  \
+  { 35, 37, 40, 34, 39, 33, 36, 38,  1,  2,  3,  4,  5,  6,  7,  8, 27, 29, 32, 26, 31, 25, 28, 30,    \
+    48, 47, 46, 45, 44, 43, 42, 41, 14, 12,  9, 15, 10, 16, 13, 11, 19, 21, 24, 18, 23, 17, 20, 22 },  \
+  { 38, 36, 33, 39, 34, 40, 37, 35, 48, 47, 46, 45, 44, 43, 42, 41, 14, 12,  9, 15, 10, 16, 13, 11,    \
+     1,  2,  3,  4,  5,  6,  7,  8, 27, 29, 32, 26, 31, 25, 28, 30, 22, 20, 17, 23, 18, 24, 21, 19 },  \
+  { 32, 31, 30, 29, 28, 27, 26, 25, 38, 36, 33, 39, 34, 40, 37, 35,  3,  5,  8,  2,  7,  1,  4,  6,    \
+    19, 21, 24, 18, 23, 17, 20, 22, 43, 45, 48, 42, 47, 41, 44, 46,  9, 10, 11, 12, 13, 14, 15, 16 },  \
+  { 25, 26, 27, 28, 29, 30, 31, 32, 19, 21, 24, 18, 23, 17, 20, 22, 43, 45, 48, 42, 47, 41, 44, 46,    \
+    38, 36, 33, 39, 34, 40, 37, 35,  3,  5,  8,  2,  7,  1,  4,  6, 16, 15, 14, 13, 12, 11, 10,  9 },  \
+  { 16, 15, 14, 13, 12, 11, 10,  9, 22, 20, 17, 23, 18, 24, 21, 19,  6,  4,  1,  7,  2,  8,  5,  3,    \
+    35, 37, 40, 34, 39, 33, 36, 38, 46, 44, 41, 47, 42, 48, 45, 43, 25, 26, 27, 28, 29, 30, 31, 32 },  \
+  {  9, 10, 11, 12, 13, 14, 15, 16, 35, 37, 40, 34, 39, 33, 36, 38, 46, 44, 41, 47, 42, 48, 45, 43,    \
+    22, 20, 17, 23, 18, 24, 21, 19,  6,  4,  1,  7,  2,  8,  5,  3, 32, 31, 30, 29, 28, 27, 26, 25 },  \
+  {  6,  4,  1,  7,  2,  8,  5,  3, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,    \
+    33, 34, 35, 36, 37, 38, 39, 40,  9, 10, 11, 12, 13, 14, 15, 16, 43, 45, 48, 42, 47, 41, 44, 46 },  \
+  {  3,  5,  8,  2,  7,  1,  4,  6, 33, 34, 35, 36, 37, 38, 39, 40,  9, 10, 11, 12, 13, 14, 15, 16,    \
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 46, 44, 41, 47, 42, 48, 45, 43 },  \
+  { 46, 44, 41, 47, 42, 48, 45, 43, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,    \
+    24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,  9,  3,  5,  8,  2,  7,  1,  4,  6 },  \
+  { 43, 45, 48, 42, 47, 41, 44, 46, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,  9,    \
+    40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,  6,  4,  1,  7,  2,  8,  5,  3 },  \
+  { 30, 28, 25, 31, 26, 32, 29, 27, 43, 45, 48, 42, 47, 41, 44, 46, 38, 36, 33, 39, 34, 40, 37, 35,    \
+     3,  5,  8,  2,  7,  1,  4,  6, 19, 21, 24, 18, 23, 17, 20, 22, 14, 12,  9, 15, 10, 16, 13, 11 },  \
+  { 27, 29, 32, 26, 31, 25, 28, 30,  3,  5,  8,  2,  7,  1,  4,  6, 19, 21, 24, 18, 23, 17, 20, 22,    \
+    43, 45, 48, 42, 47, 41, 44, 46, 38, 36, 33, 39, 34, 40, 37, 35, 11, 13, 16, 10, 15,  9, 12, 14 },  \
+  { 11, 13, 16, 10, 15,  9, 12, 14,  6,  4,  1,  7,  2,  8,  5,  3, 35, 37, 40, 34, 39, 33, 36, 38,    \
+    46, 44, 41, 47, 42, 48, 45, 43, 22, 20, 17, 23, 18, 24, 21, 19, 27, 29, 32, 26, 31, 25, 28, 30 },  \
+  { 14, 12,  9, 15, 10, 16, 13, 11, 46, 44, 41, 47, 42, 48, 45, 43, 22, 20, 17, 23, 18, 24, 21, 19,    \
+     6,  4,  1,  7,  2,  8,  5,  3, 35, 37, 40, 34, 39, 33, 36, 38, 30, 28, 25, 31, 26, 32, 29, 27 },  \
+  { 40, 39, 38, 37, 36, 35, 34, 33, 14, 12,  9, 15, 10, 16, 13, 11,  1,  2,  3,  4,  5,  6,  7,  8,    \
+    27, 29, 32, 26, 31, 25, 28, 30, 48, 47, 46, 45, 44, 43, 42, 41, 17, 18, 19, 20, 21, 22, 23, 24 },  \
+  { 33, 34, 35, 36, 37, 38, 39, 40, 27, 29, 32, 26, 31, 25, 28, 30, 48, 47, 46, 45, 44, 43, 42, 41,    \
+    14, 12,  9, 15, 10, 16, 13, 11,  1,  2,  3,  4,  5,  6,  7,  8, 24, 23, 22, 21, 20, 19, 18, 17 },  \
+  { 24, 23, 22, 21, 20, 19, 18, 17, 30, 28, 25, 31, 26, 32, 29, 27,  8,  7,  6,  5,  4,  3,  2,  1,    \
+    11, 13, 16, 10, 15,  9, 12, 14, 41, 42, 43, 44, 45, 46, 47, 48, 33, 34, 35, 36, 37, 38, 39, 40 },  \
+  { 17, 18, 19, 20, 21, 22, 23, 24, 11, 13, 16, 10, 15,  9, 12, 14, 41, 42, 43, 44, 45, 46, 47, 48,    \
+    30, 28, 25, 31, 26, 32, 29, 27,  8,  7,  6,  5,  4,  3,  2,  1, 40, 39, 38, 37, 36, 35, 34, 33 }
+
+#define PARAMS_3X3X3_CONJUGATES \
+  {  0,  1,  2,  3,  4,  5 },  \
+  {  0,  3,  4,  1,  2,  5 },  \
+  {  5,  3,  2,  1,  4,  0 },  \
+  {  5,  1,  4,  3,  2,  0 },  \
+  {  2,  5,  3,  0,  1,  4 },  \
+  {  2,  0,  1,  5,  3,  4 },  \
+  {  4,  0,  3,  5,  1,  2 },  \
+  {  4,  5,  1,  0,  3,  2 },  \
+  {  3,  4,  0,  2,  5,  1 },  \
+  {  3,  2,  5,  4,  0,  1 },  \
+  {  1,  2,  0,  4,  5,  3 },  \
+  {  1,  4,  5,  2,  0,  3 },  \
+  {  0,  2,  3,  4,  1,  5 },  \
+  {  0,  4,  1,  2,  3,  5 },  \
+  {  5,  4,  3,  2,  1,  0 },  \
+  {  5,  2,  1,  4,  3,  0 },  \
+  {  3,  5,  4,  0,  2,  1 },  \
+  {  3,  0,  2,  5,  4,  1 },  \
+  {  1,  0,  4,  5,  2,  3 },  \
+  {  1,  5,  2,  0,  4,  3 },  \
+  {  4,  1,  0,  3,  5,  2 },  \
+  {  4,  3,  5,  1,  0,  2 },  \
+  {  2,  3,  0,  1,  5,  4 },  \
+  {  2,  1,  5,  3,  0,  4 }
 
 // clang-format on
 
-static const uint16_t params_3x3x3_f[] = { PARAMS_3X3X3_F_INTERLEAVED };
-static const uint16_t params_3x3x3_h[] = { PARAMS_3X3X3_H_INTERLEAVED };
+#define PARAMS_3X3X3_STRIDE PERMUTATION_ARRAY_STRIDE(ZKP_PARAMS_3X3X3_DOMAIN)
+
+static const uint8_t params_3x3x3_f[ZKP_PARAMS_3X3X3_ALPHA]
+                                  [PARAMS_3X3X3_STRIDE] CACHE_ALIGNED = {
+  PARAMS_3X3X3_F
+};
+static const uint8_t params_3x3x3_h[ZKP_PARAMS_3X3X3_H_ORDER]
+                                  [PARAMS_3X3X3_STRIDE] CACHE_ALIGNED = {
+  PARAMS_3X3X3_H
+};
+
+// The index of H[tau]^-1 * F[i] * H[tau] in F is conjugates[tau][i].
+static const uint8_t params_3x3x3_conjugates[ZKP_PARAMS_3X3X3_H_ORDER]
+                                           [ZKP_PARAMS_3X3X3_ALPHA] = {
+  PARAMS_3X3X3_CONJUGATES
+};
+
+// The stabilizer chain of the group generated by F and H, which is built once.
+static stabilizer_chain chain_3x3x3;
+
+static init_once_flag initialized = INIT_ONCE_FLAG;
+
+DEFINE_PERMUTATION_ENGINE(engine_3x3x3, small, uint8_t,
+                          ZKP_PARAMS_3X3X3_DOMAIN);
 
 static const zkp_params params = {
   .domain = ZKP_PARAMS_3X3X3_DOMAIN,
   .d = ZKP_PARAMS_3X3X3_D,
-  .F = { .base = params_3x3x3_f,
+  .F = { .base.small = params_3x3x3_f[0],
          .count = ZKP_PARAMS_3X3X3_ALPHA,
          .domain = ZKP_PARAMS_3X3X3_DOMAIN },
-  .H = { .base = params_3x3x3_h,
+  .H = { .base.small = params_3x3x3_h[0],
          .count = ZKP_PARAMS_3X3X3_H_ORDER,
          .domain = ZKP_PARAMS_3X3X3_DOMAIN },
-  .G_ = { .random_element = random_element_F_H },
+  .G_ = { .random_element = random_element_stabilizer_chain,
+          .chain = &chain_3x3x3 },
+  .engine = &engine_3x3x3,
+  .conjugates = params_3x3x3_conjugates[0],
+  .commitment = &commitment_hmac_sha256,
   .display_name = "3x3x3 Rubik's Cube",
 };
 
+static void init_chain(void) {
+  const permutation_array* const generators[] = { &params.F, &params.H };
+  const int built = build_stabilizer_chain(&chain_3x3x3, generators, 2);
+  // Without the chain, every random element would be the identity, which breaks
+  // key generation and the zero knowledge of proofs, even if NDEBUG is defined.
+  if (!built) {
+    abort();
+  }
+}
+
 const zkp_params* zkp_params_3x3x3(void) {
+  init_once(&initialized, init_chain);
   return &params;
 }
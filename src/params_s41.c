@@ -14,66 +14,55 @@
       18, 12, 2, 22, 24, 8, 32, 3, 36, 9, 6, 13, 33, 25, 21, 7, 39, 16, 35,    \
       15, 19
 
-static int initialized = 0;
+static init_once_flag initialized = INIT_ONCE_FLAG;
+
+DEFINE_PERMUTATION_ENGINE(engine_s41, small, uint8_t, ZKP_PARAMS_S41_DOMAIN);
 
 static zkp_params params = {
   .domain = ZKP_PARAMS_S41_DOMAIN,
   .d = ZKP_PARAMS_S41_D,
-  .F = { .base = NULL,
+  .F = { .base.small = NULL,
          .count = ZKP_PARAMS_S41_ALPHA,
          .domain = ZKP_PARAMS_S41_DOMAIN },
-  .H = { .base = NULL,
+  .H = { .base.small = NULL,
          .count = ZKP_PARAMS_S41_H_ORDER,
          .domain = ZKP_PARAMS_S41_DOMAIN },
   .G_ = { .random_element = random_element_symmetric_group },
+  .engine = &engine_s41,
+  .cyclic = 1,
+  .commitment = &commitment_hmac_sha256,
   .display_name = "S41",
 };
 
-static inline void init_dynamically_allocated(void) {
-  uint16_t* params_s41_h =
-      malloc(ZKP_PARAMS_S41_H_ORDER * ZKP_PARAMS_S41_DOMAIN * sizeof(uint16_t));
-  assert(params_s41_h != NULL);
-  params.H.base = params_s41_h;
+static uint8_t s41_f_1_mapping[] = { PARAMS_S41_F_1 };
+static const permutation s41_f_1 = { .mapping.small = s41_f_1_mapping,
+                                     .domain = ZKP_PARAMS_S41_DOMAIN };
+static uint16_t s41_h_cycles[ZKP_PARAMS_S41_DOMAIN];
+static uint16_t s41_h_cycle_lengths[ZKP_PARAMS_S41_DOMAIN];
+static implicit_permutation_array implicit_h, implicit_f;
 
-  unsigned int s41_h_mapping[] = { PARAMS_S41_H_GENERATOR };
+static void init_dynamically_allocated(void) {
+  uint8_t s41_h_mapping[] = { PARAMS_S41_H_GENERATOR };
 
   permutation s41_h;
   s41_h.domain = ZKP_PARAMS_S41_DOMAIN;
-  s41_h.mapping = s41_h_mapping;
-  STACK_ALLOC_PERMUTATION(acc, ZKP_PARAMS_S41_DOMAIN);
-  identity_permutation(&acc);
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S41_H_ORDER; exp++) {
-    store_permutation_interleaved(&params.H, params_s41_h, exp, &acc);
-    multiply_permutation(&acc, &s41_h);
-  }
-  for (unsigned int i = 1; i <= ZKP_PARAMS_S41_DOMAIN; i++) {
-    assert(PERMUTATION_GET(&acc, i) == i);
+  s41_h.mapping.small = s41_h_mapping;
+  init_implicit_permutation_array(&implicit_h, &s41_h, s41_h_cycles,
+                                  s41_h_cycle_lengths, NULL);
+  for (unsigned int i = 0; i < implicit_h.n_cycles; i++) {
+    assert(ZKP_PARAMS_S41_H_ORDER % implicit_h.cycle_lengths[i] == 0);
   }
+  implicit_f = implicit_h;
+  implicit_f.f = &s41_f_1;
+  params.H.implicit = &implicit_h;
+  params.F.implicit = &implicit_f;
 
-  uint16_t* params_s41_f =
-      malloc(ZKP_PARAMS_S41_ALPHA * ZKP_PARAMS_S41_DOMAIN * sizeof(uint16_t));
-  assert(params_s41_f != NULL);
-  params.F.base = params_s41_f;
-
-  unsigned int s41_f_1_mapping[] = { PARAMS_S41_F_1 };
-
-  permutation s41_f_1;
-  s41_f_1.domain = ZKP_PARAMS_S41_DOMAIN;
-  s41_f_1.mapping = s41_f_1_mapping;
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S41_ALPHA; exp++) {
-    identity_permutation(&acc);
-    multiply_permutation_from_array_inv(&acc, &params.H, exp);
-    multiply_permutation(&acc, &s41_f_1);
-    multiply_permutation_from_array(&acc, &params.H, exp);
-    store_permutation_interleaved(&params.F, params_s41_f, exp, &acc);
-  }
+#ifndef ZKP_IMPLICIT_TABLES
+  materialize_params_tables(&params, "s41");
+#endif
 }
 
 const zkp_params* zkp_params_s41(void) {
-  if (!initialized) {
-    init_dynamically_allocated();
-    initialized = 1;
-  }
-
+  init_once(&initialized, init_dynamically_allocated);
   return &params;
 }
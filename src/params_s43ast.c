@@ -14,67 +14,56 @@
       22, 40, 14, 28, 6, 15, 4, 24, 10, 12, 34, 39, 20, 5, 8, 17, 7, 36, 31,   \
       9, 29, 32, 2, 30
 
-static int initialized = 0;
+static init_once_flag initialized = INIT_ONCE_FLAG;
+
+DEFINE_PERMUTATION_ENGINE(engine_s43ast, small, uint8_t,
+                          ZKP_PARAMS_S43_AST_DOMAIN);
 
 static zkp_params params = {
   .domain = ZKP_PARAMS_S43_AST_DOMAIN,
   .d = ZKP_PARAMS_S43_AST_D,
-  .F = { .base = NULL,
+  .F = { .base.small = NULL,
          .count = ZKP_PARAMS_S43_AST_ALPHA,
          .domain = ZKP_PARAMS_S43_AST_DOMAIN },
-  .H = { .base = NULL,
+  .H = { .base.small = NULL,
          .count = ZKP_PARAMS_S43_AST_H_ORDER,
          .domain = ZKP_PARAMS_S43_AST_DOMAIN },
   .G_ = { .random_element = random_element_symmetric_group },
+  .engine = &engine_s43ast,
+  .cyclic = 1,
+  .commitment = &commitment_hmac_sha256,
   .display_name = "S43*",
 };
 
-static inline void init_dynamically_allocated(void) {
-  uint16_t* params_s43ast_h =
-      malloc(ZKP_PARAMS_S43_AST_H_ORDER * ZKP_PARAMS_S43_AST_DOMAIN *
-             sizeof(uint16_t));
-  assert(params_s43ast_h != NULL);
-  params.H.base = params_s43ast_h;
+static uint8_t s43ast_f_1_mapping[] = { PARAMS_S43_AST_F_1 };
+static const permutation s43ast_f_1 = { .mapping.small = s43ast_f_1_mapping,
+                                        .domain = ZKP_PARAMS_S43_AST_DOMAIN };
+static uint16_t s43ast_h_cycles[ZKP_PARAMS_S43_AST_DOMAIN];
+static uint16_t s43ast_h_cycle_lengths[ZKP_PARAMS_S43_AST_DOMAIN];
+static implicit_permutation_array implicit_h, implicit_f;
 
-  unsigned int s43ast_h_mapping[] = { PARAMS_S43_AST_H_GENERATOR };
+static void init_dynamically_allocated(void) {
+  uint8_t s43ast_h_mapping[] = { PARAMS_S43_AST_H_GENERATOR };
 
   permutation s43ast_h;
   s43ast_h.domain = ZKP_PARAMS_S43_AST_DOMAIN;
-  s43ast_h.mapping = s43ast_h_mapping;
-  STACK_ALLOC_PERMUTATION(acc, ZKP_PARAMS_S43_AST_DOMAIN);
-  identity_permutation(&acc);
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S43_AST_H_ORDER; exp++) {
-    store_permutation_interleaved(&params.H, params_s43ast_h, exp, &acc);
-    multiply_permutation(&acc, &s43ast_h);
-  }
-  for (unsigned int i = 1; i <= ZKP_PARAMS_S43_AST_DOMAIN; i++) {
-    assert(PERMUTATION_GET(&acc, i) == i);
+  s43ast_h.mapping.small = s43ast_h_mapping;
+  init_implicit_permutation_array(&implicit_h, &s43ast_h, s43ast_h_cycles,
+                                  s43ast_h_cycle_lengths, NULL);
+  for (unsigned int i = 0; i < implicit_h.n_cycles; i++) {
+    assert(ZKP_PARAMS_S43_AST_H_ORDER % implicit_h.cycle_lengths[i] == 0);
   }
+  implicit_f = implicit_h;
+  implicit_f.f = &s43ast_f_1;
+  params.H.implicit = &implicit_h;
+  params.F.implicit = &implicit_f;
 
-  uint16_t* params_s43ast_f = malloc(
-      ZKP_PARAMS_S43_AST_ALPHA * ZKP_PARAMS_S43_AST_DOMAIN * sizeof(uint16_t));
-  assert(params_s43ast_f != NULL);
-  params.F.base = params_s43ast_f;
-
-  unsigned int s43ast_f_1_mapping[] = { PARAMS_S43_AST_F_1 };
-
-  permutation s43ast_f_1;
-  s43ast_f_1.domain = ZKP_PARAMS_S43_AST_DOMAIN;
-  s43ast_f_1.mapping = s43ast_f_1_mapping;
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S43_AST_ALPHA; exp++) {
-    identity_permutation(&acc);
-    multiply_permutation_from_array_inv(&acc, &params.H, exp);
-    multiply_permutation(&acc, &s43ast_f_1);
-    multiply_permutation_from_array(&acc, &params.H, exp);
-    store_permutation_interleaved(&params.F, params_s43ast_f, exp, &acc);
-  }
+#ifndef ZKP_IMPLICIT_TABLES
+  materialize_params_tables(&params, "s43ast");
+#endif
 }
 
 const zkp_params* zkp_params_s43ast(void) {
-  if (!initialized) {
-    init_dynamically_allocated();
-    initialized = 1;
-  }
-
+  init_once(&initialized, init_dynamically_allocated);
   return &params;
 }
@@ -14,67 +14,56 @@
       49, 39, 17, 40, 38, 37, 28, 23, 32, 51, 45, 10, 43, 33, 18, 6, 53, 5, 4, \
       12, 13, 46, 47, 29, 2, 15, 14, 21, 20, 35, 50, 9, 25
 
-static int initialized = 0;
+static init_once_flag initialized = INIT_ONCE_FLAG;
+
+DEFINE_PERMUTATION_ENGINE(engine_s53ast, small, uint8_t,
+                          ZKP_PARAMS_S53_AST_DOMAIN);
 
 static zkp_params params = {
   .domain = ZKP_PARAMS_S53_AST_DOMAIN,
   .d = ZKP_PARAMS_S53_AST_D,
-  .F = { .base = NULL,
+  .F = { .base.small = NULL,
          .count = ZKP_PARAMS_S53_AST_ALPHA,
          .domain = ZKP_PARAMS_S53_AST_DOMAIN },
-  .H = { .base = NULL,
+  .H = { .base.small = NULL,
          .count = ZKP_PARAMS_S53_AST_H_ORDER,
          .domain = ZKP_PARAMS_S53_AST_DOMAIN },
   .G_ = { .random_element = random_element_symmetric_group },
+  .engine = &engine_s53ast,
+  .cyclic = 1,
+  .commitment = &commitment_hmac_sha256,
   .display_name = "S53*",
 };
 
-static inline void init_dynamically_allocated(void) {
-  uint16_t* params_s53ast_h =
-      malloc(ZKP_PARAMS_S53_AST_H_ORDER * ZKP_PARAMS_S53_AST_DOMAIN *
-             sizeof(uint16_t));
-  assert(params_s53ast_h != NULL);
-  params.H.base = params_s53ast_h;
+static uint8_t s53ast_f_1_mapping[] = { PARAMS_S53_AST_F_1 };
+static const permutation s53ast_f_1 = { .mapping.small = s53ast_f_1_mapping,
+                                        .domain = ZKP_PARAMS_S53_AST_DOMAIN };
+static uint16_t s53ast_h_cycles[ZKP_PARAMS_S53_AST_DOMAIN];
+static uint16_t s53ast_h_cycle_lengths[ZKP_PARAMS_S53_AST_DOMAIN];
+static implicit_permutation_array implicit_h, implicit_f;
 
-  unsigned int s53ast_h_mapping[] = { PARAMS_S53_AST_H_GENERATOR };
+static void init_dynamically_allocated(void) {
+  uint8_t s53ast_h_mapping[] = { PARAMS_S53_AST_H_GENERATOR };
 
   permutation s53ast_h;
   s53ast_h.domain = ZKP_PARAMS_S53_AST_DOMAIN;
-  s53ast_h.mapping = s53ast_h_mapping;
-  STACK_ALLOC_PERMUTATION(acc, ZKP_PARAMS_S53_AST_DOMAIN);
-  identity_permutation(&acc);
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S53_AST_H_ORDER; exp++) {
-    store_permutation_interleaved(&params.H, params_s53ast_h, exp, &acc);
-    multiply_permutation(&acc, &s53ast_h);
-  }
-  for (unsigned int i = 1; i <= ZKP_PARAMS_S53_AST_DOMAIN; i++) {
-    assert(PERMUTATION_GET(&acc, i) == i);
+  s53ast_h.mapping.small = s53ast_h_mapping;
+  init_implicit_permutation_array(&implicit_h, &s53ast_h, s53ast_h_cycles,
+                                  s53ast_h_cycle_lengths, NULL);
+  for (unsigned int i = 0; i < implicit_h.n_cycles; i++) {
+    assert(ZKP_PARAMS_S53_AST_H_ORDER % implicit_h.cycle_lengths[i] == 0);
   }
+  implicit_f = implicit_h;
+  implicit_f.f = &s53ast_f_1;
+  params.H.implicit = &implicit_h;
+  params.F.implicit = &implicit_f;
 
-  uint16_t* params_s53ast_f = malloc(
-      ZKP_PARAMS_S53_AST_ALPHA * ZKP_PARAMS_S53_AST_DOMAIN * sizeof(uint16_t));
-  assert(params_s53ast_f != NULL);
-  params.F.base = params_s53ast_f;
-
-  unsigned int s53ast_f_1_mapping[] = { PARAMS_S53_AST_F_1 };
-
-  permutation s53ast_f_1;
-  s53ast_f_1.domain = ZKP_PARAMS_S53_AST_DOMAIN;
-  s53ast_f_1.mapping = s53ast_f_1_mapping;
-  for (unsigned int exp = 0; exp < ZKP_PARAMS_S53_AST_ALPHA; exp++) {
-    identity_permutation(&acc);
-    multiply_permutation_from_array_inv(&acc, &params.H, exp);
-    multiply_permutation(&acc, &s53ast_f_1);
-    multiply_permutation_from_array(&acc, &params.H, exp);
-    store_permutation_interleaved(&params.F, params_s53ast_f, exp, &acc);
-  }
+#ifndef ZKP_IMPLICIT_TABLES
+  materialize_params_tables(&params, "s53ast");
+#endif
 }
 
 const zkp_params* zkp_params_s53ast(void) {
-  if (!initialized) {
-    init_dynamically_allocated();
-    initialized = 1;
-  }
-
+  init_once(&initialized, init_dynamically_allocated);
   return &params;
 }
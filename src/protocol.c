@@ -1,13 +1,55 @@
-#include "commitment.h"
 #include "internals.h"
 
 #include <assert.h>
 #include <math.h>
 #include <string.h>
 
-#define Q_NONE ((unsigned int) -1)
+DEFINE_PERMUTATION_ENGINE_FUNCTIONS(generic_small, small, uint8_t, dst->domain)
+DEFINE_PERMUTATION_ENGINE_FUNCTIONS(generic_large, large, uint16_t, dst->domain)
 
-#define MAX_DOMAIN_SMALL_REPR 255
+static void generic_compose3(permutation* dst, const permutation* a,
+                             const permutation* b, const permutation* c) {
+  if (PERMUTATION_IS_SMALL(dst)) {
+    generic_small_compose3(dst, a, b, c);
+  } else {
+    generic_large_compose3(dst, a, b, c);
+  }
+}
+
+static void generic_conjugate(permutation* dst, const permutation_array* f,
+                              unsigned int index, const permutation* tau) {
+  if (PERMUTATION_IS_SMALL(dst)) {
+    generic_small_conjugate(dst, f, index, tau);
+  } else {
+    generic_large_conjugate(dst, f, index, tau);
+  }
+}
+
+static void generic_conjugate_compose(permutation* dst, const permutation* x,
+                                      const permutation* tau,
+                                      const permutation* sigma) {
+  if (PERMUTATION_IS_SMALL(dst)) {
+    generic_small_conjugate_compose(dst, x, tau, sigma);
+  } else {
+    generic_large_conjugate_compose(dst, x, tau, sigma);
+  }
+}
+
+static void generic_compose(permutation* dst, const permutation_array* f,
+                            unsigned int index, const permutation* sigma) {
+  if (PERMUTATION_IS_SMALL(dst)) {
+    generic_small_compose(dst, f, index, sigma);
+  } else {
+    generic_large_compose(dst, f, index, sigma);
+  }
+}
+
+const permutation_engine generic_permutation_engine = {
+  .compose3 = generic_compose3,
+  .conjugate = generic_conjugate,
+  .conjugate_compose = generic_conjugate_compose,
+  .compose = generic_compose,
+};
 
 const char* zkp_get_params_name(const zkp_params* params) {
   return params->display_name;
@@ -17,32 +59,86 @@ static inline unsigned int portable_repr_perm_size(unsigned int domain) {
   return (domain > MAX_DOMAIN_SMALL_REPR ? 2 : 1) * domain;
 }
 
+// Returns the portable representation of the given permutation. Small
+// permutations are stored in their portable representation already, in which
+// case repr is left untouched and the mapping itself is returned.
+static inline const unsigned char* portable_repr_perm(const permutation* perm,
+                                                      unsigned char* repr) {
+  if (PERMUTATION_IS_SMALL(perm)) {
+    return perm->mapping.small;
+  }
+
+  for (unsigned int j = 0; j < perm->domain; j++) {
+    unsigned int val = perm->mapping.large[j];
+    repr[2 * j] = val % MAX_DOMAIN_SMALL_REPR;
+    repr[2 * j + 1] = val / MAX_DOMAIN_SMALL_REPR;
+  }
+  return repr;
+}
+
+void encode_permutation_array_reprs(const permutation_array* array,
+                                    unsigned char* reprs) {
+  const unsigned int size = portable_repr_perm_size(array->domain);
+  STACK_ALLOC_PERMUTATION(buf, array->domain);
+  for (unsigned int i = 0; i < array->count; i++) {
+    const permutation element = load_permutation_from_array(array, i, &buf);
+    const unsigned char* repr = portable_repr_perm(&element, reprs);
+    if (repr != reprs) {
+      memcpy(reprs, repr, size);
+    }
+    reprs += size;
+  }
+}
+
+// Returns the portable representation of tau = H[tau_index], which is stored
+// in the parameters if encoding it would require a pass over tau.
+static inline const unsigned char* portable_repr_tau(const zkp_params* params,
+                                                     unsigned int tau_index,
+                                                     const permutation* tau,
+                                                     unsigned char* repr) {
+  if (params->h_reprs != NULL) {
+    return params->h_reprs +
+           (size_t) tau_index * portable_repr_perm_size(params->domain);
+  }
+  return portable_repr_perm(tau, repr);
+}
+
 static inline void encode_portable_repr_perm(const permutation* perm,
                                              unsigned char* repr) {
-  unsigned int domain = perm->domain;
-  for (unsigned int j = 0; j < domain; j++) {
-    unsigned int val = PERMUTATION_GET(perm, j + 1);
-    if (domain > MAX_DOMAIN_SMALL_REPR) {
-      repr[2 * j] = val % MAX_DOMAIN_SMALL_REPR;
-      repr[2 * j + 1] = val / MAX_DOMAIN_SMALL_REPR;
-    } else {
-      repr[j] = val;
-    }
+  const unsigned char* encoded = portable_repr_perm(perm, repr);
+  if (encoded != repr) {
+    memcpy(repr, encoded, portable_repr_perm_size(perm->domain));
   }
 }
 
+// Decodes a permutation and checks that it is valid, see is_permutation. Large
+// permutations are decoded and checked in a single pass.
 static inline int decode_portable_repr_perm(permutation* out,
                                             const unsigned char* repr) {
-  for (unsigned int j = 0; j < out->domain; j++) {
-    unsigned int val;
-    if (out->domain > MAX_DOMAIN_SMALL_REPR) {
-      val = repr[2 * j] + repr[2 * j + 1] * MAX_DOMAIN_SMALL_REPR;
-    } else {
-      val = repr[j];
+  const unsigned int n = out->domain;
+  if (PERMUTATION_IS_SMALL(out)) {
+    memcpy(out->mapping.small, repr, n);
+    return is_permutation(out);
+  }
+
+  uint64_t seen[(n + 63) / 64];
+  memset(seen, 0, sizeof(seen));
+  uint16_t* m = out->mapping.large;
+  for (unsigned int j = 0; j < n; j++) {
+    const unsigned int label =
+        repr[2 * j] + repr[2 * j + 1] * MAX_DOMAIN_SMALL_REPR;
+    const unsigned int v = label - 1;
+    if (v >= n) {
+      return 0;
     }
-    PERMUTATION_SET(out, j + 1, val);
+    const uint64_t bit = UINT64_C(1) << (v % 64);
+    if (seen[v / 64] & bit) {
+      return 0;
+    }
+    seen[v / 64] |= bit;
+    m[j] = (uint16_t) label;
   }
-  return is_permutation(out);
+  return 1;
 }
 
 unsigned int zkp_get_public_key_size(const zkp_params* params) {
@@ -79,29 +175,26 @@ unsigned int zkp_get_answer_size(const zkp_params* params, unsigned int q) {
 }
 
 static int preallocate_answer(const zkp_params* params, zkp_answer* answer) {
-  answer->q_eq_0.sigma_0.domain = params->domain;
-  answer->q_eq_0.sigma_0.mapping =
-      malloc(params->domain * sizeof(unsigned int));
-  if (answer->q_eq_0.sigma_0.mapping == NULL) {
+  if (!alloc_permutation(&answer->q_eq_0.sigma_0, params->domain)) {
     return 0;
   }
 
   answer->q_eq_0.k_star = malloc(COMMITMENT_SIZE);
   if (answer->q_eq_0.k_star == NULL) {
-    free(answer->q_eq_0.sigma_0.mapping);
+    free_permutation(&answer->q_eq_0.sigma_0);
     return 0;
   }
 
   answer->q_eq_0.k_0 = malloc(COMMITMENT_SIZE);
   if (answer->q_eq_0.k_0 == NULL) {
-    free(answer->q_eq_0.sigma_0.mapping);
+    free_permutation(&answer->q_eq_0.sigma_0);
     free(answer->q_eq_0.k_star);
     return 0;
   }
 
   answer->q_eq_0.k_d = malloc(COMMITMENT_SIZE);
   if (answer->q_eq_0.k_d == NULL) {
-    free(answer->q_eq_0.sigma_0.mapping);
+    free_permutation(&answer->q_eq_0.sigma_0);
     free(answer->q_eq_0.k_star);
     free(answer->q_eq_0.k_0);
     return 0;
@@ -120,32 +213,146 @@ static int preallocate_answer(const zkp_params* params, zkp_answer* answer) {
 }
 
 static void free_preallocated_answer(zkp_answer* answer) {
-  free(answer->q_eq_0.sigma_0.mapping);
+  free_permutation(&answer->q_eq_0.sigma_0);
   free(answer->q_eq_0.k_star);
   free(answer->q_eq_0.k_0);
   free(answer->q_eq_0.k_d);
 }
 
+static int preallocate_scratch(const zkp_params* params,
+                               permutation* scratch) {
+  for (unsigned int i = 0; i < N_SCRATCH_PERMUTATIONS; i++) {
+    if (!alloc_permutation(&scratch[i], params->domain)) {
+      while (i-- != 0) {
+        free_permutation(&scratch[i]);
+      }
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void free_preallocated_scratch(permutation* scratch) {
+  for (unsigned int i = 0; i < N_SCRATCH_PERMUTATIONS; i++) {
+    free_permutation(&scratch[i]);
+  }
+}
+
+static void free_preallocated_sigma(zkp_proof* proof) {
+  for (unsigned int i = 0; i <= proof->key->params->d; i++) {
+    free_permutation(&proof->round.secrets.sigma[i]);
+  }
+  free(proof->round.sigma_reprs);
+}
+
 static int preallocate_sigma(zkp_proof* proof) {
   const zkp_params* params = proof->key->params;
   permutation* sigma = proof->round.secrets.sigma;
   for (unsigned int i = 0; i <= params->d; i++) {
-    sigma[i].domain = params->domain;
-    sigma[i].mapping = malloc(sizeof(unsigned int) * params->domain);
-    if (sigma[i].mapping == NULL) {
+    if (!alloc_permutation(&sigma[i], params->domain)) {
       while (i-- != 0) {
-        free(sigma[i].mapping);
+        free_permutation(&sigma[i]);
       }
       return 0;
     }
   }
+  proof->round.sigma_reprs = NULL;
+  if (!PERMUTATION_IS_SMALL(&sigma[0])) {
+    proof->round.sigma_reprs =
+        malloc((params->d + 1) * portable_repr_perm_size(params->domain));
+    if (proof->round.sigma_reprs == NULL) {
+      free_preallocated_sigma(proof);
+      return 0;
+    }
+  }
   return 1;
 }
 
-static void free_preallocated_sigma(zkp_proof* proof) {
-  for (unsigned int i = 0; i <= proof->key->params->d; i++) {
-    free(proof->round.secrets.sigma[i].mapping);
+static int compute_prefix_products(zkp_proof* proof) {
+  const zkp_params* params = proof->key->params;
+  permutation* prefix = proof->prefix;
+  for (unsigned int j = 0; j < params->d; j++) {
+    if (!alloc_permutation(&prefix[j], params->domain)) {
+      while (j-- != 0) {
+        free_permutation(&prefix[j]);
+      }
+      return 0;
+    }
+  }
+
+  // P_j = F[i_j]^-1 * P_{j-1}, where P_0 is the identity.
+  permutation* identity = &proof->scratch[0];
+  identity_permutation(identity);
+  for (unsigned int j = 0; j < params->d; j++) {
+    const permutation f = load_permutation_from_array(
+        &params->F, proof->key->i[j], &proof->scratch[1]);
+    compose_inverse_with_permutation(&prefix[j], &f,
+                                     j == 0 ? identity : &prefix[j - 1]);
+  }
+  return 1;
+}
+
+static void free_prefix_products(zkp_proof* proof) {
+  // P_1 = F[i_1]^-1, and each P_j reveals i_j given P_{j-1}.
+  for (unsigned int j = 0; j < proof->key->params->d; j++) {
+    wipe_permutation(&proof->prefix[j]);
+    free_permutation(&proof->prefix[j]);
+  }
+}
+
+typedef char insecure_seed_size_matches[
+    ZKP_INSECURE_SEED_SIZE == RANDOM_SEED_SIZE ? 1 : -1];
+
+// Replaces the source of all random choices of a proof or verification by a
+// deterministic one.
+static int seed_context(random_source** rng, const unsigned char* seed) {
+  if (*rng == NULL && (*rng = malloc(sizeof(random_source))) == NULL) {
+    return 0;
+  }
+  seed_random_source(*rng, seed);
+  return 1;
+}
+
+// The conjugates are equivalent to the indices of the private key, and are
+// wiped like them. f_inv only holds the inverses of F, but is wiped as well, so
+// that no part of the expanded key outlives the proof.
+static void free_expanded_key(zkp_proof* proof, unsigned int n_f_inv) {
+  const zkp_params* params = proof->key->params;
+  for (unsigned int k = 0; k < n_f_inv; k++) {
+    wipe_permutation(&proof->f_inv[k]);
+    free_permutation(&proof->f_inv[k]);
   }
+  free(proof->f_inv);
+  if (proof->conjugates != NULL) {
+    memset(proof->conjugates, 0, params->H.count * params->d);
+  }
+  free(proof->conjugates);
+}
+
+static int expand_private_key(zkp_proof* proof) {
+  const zkp_params* params = proof->key->params;
+  proof->conjugates = malloc(params->H.count * params->d);
+  proof->f_inv = malloc(sizeof(permutation) * params->F.count);
+  if (proof->conjugates == NULL || proof->f_inv == NULL) {
+    free_expanded_key(proof, 0);
+    return 0;
+  }
+  for (unsigned int k = 0; k < params->F.count; k++) {
+    if (!alloc_permutation(&proof->f_inv[k], params->domain)) {
+      free_expanded_key(proof, k);
+      return 0;
+    }
+    const permutation f = permutation_array_element(&params->F, k);
+    inverse_permutation_into(&proof->f_inv[k], &f);
+  }
+
+  for (unsigned int tau = 0; tau < params->H.count; tau++) {
+    for (unsigned int j = 0; j < params->d; j++) {
+      proof->conjugates[tau * params->d + j] =
+          params->conjugates[tau * params->F.count + proof->key->i[j]];
+    }
+  }
+  return 1;
 }
 
 zkp_proof* zkp_new_proof(const zkp_private_key* key) {
@@ -159,6 +366,8 @@ zkp_proof* zkp_new_proof(const zkp_private_key* key) {
   }
 
   proof->key = key;
+  init_commitment_engine(&proof->commitment, key->params->commitment);
+  proof->rng = NULL;
 
   proof->round.secrets.sigma =
       malloc(sizeof(permutation) * (1 + key->params->d));
@@ -199,6 +408,38 @@ zkp_proof* zkp_new_proof(const zkp_private_key* key) {
     return NULL;
   }
 
+  if (!preallocate_scratch(key->params, proof->scratch)) {
+    free_preallocated_sigma(proof);
+    free_preallocated_answer(&proof->round.answer);
+    free(proof->round.secrets.sigma);
+    free(proof->round.secrets.k);
+    free(proof->round.commitments);
+    free(proof);
+    return NULL;
+  }
+
+  proof->prefix = NULL;
+  proof->conjugates = NULL;
+  proof->f_inv = NULL;
+  int ok;
+  if (key->params->conjugates != NULL) {
+    ok = expand_private_key(proof);
+  } else {
+    proof->prefix = malloc(sizeof(permutation) * key->params->d);
+    ok = proof->prefix != NULL && compute_prefix_products(proof);
+  }
+  if (!ok) {
+    free(proof->prefix);
+    free_preallocated_scratch(proof->scratch);
+    free_preallocated_sigma(proof);
+    free_preallocated_answer(&proof->round.answer);
+    free(proof->round.secrets.sigma);
+    free(proof->round.secrets.k);
+    free(proof->round.commitments);
+    free(proof);
+    return NULL;
+  }
+
   return proof;
 }
 
@@ -207,11 +448,24 @@ void zkp_free_proof(zkp_proof* proof) {
   free(proof->round.commitments);
   free_preallocated_answer(&proof->round.answer);
   free_preallocated_sigma(proof);
+  free_preallocated_scratch(proof->scratch);
+  if (proof->prefix != NULL) {
+    free_prefix_products(proof);
+    free(proof->prefix);
+  } else {
+    free_expanded_key(proof, proof->key->params->F.count);
+  }
   free(proof->round.secrets.sigma);
+  free(proof->rng);
   free(proof);
 }
 
-const zkp_private_key* zkp_generate_private_key(const zkp_params* params) {
+int zkp_insecure_seed_proof(zkp_proof* proof, const unsigned char* seed) {
+  return seed_context(&proof->rng, seed);
+}
+
+static const zkp_private_key* generate_private_key(const zkp_params* params,
+                                                   random_source* source) {
   zkp_private_key* key = malloc(sizeof(zkp_private_key));
   if (key == NULL) {
     return NULL;
@@ -227,12 +481,25 @@ const zkp_private_key* zkp_generate_private_key(const zkp_params* params) {
   }
 
   for (unsigned int j = 0; j < params->d; j++) {
-    key->i[j] = rand_less_than(params->F.count);
+    key->i[j] = rand_less_than_from(source, params->F.count);
   }
 
   return key;
 }
 
+const zkp_private_key* zkp_generate_private_key(const zkp_params* params) {
+  return generate_private_key(params, NULL);
+}
+
+const zkp_private_key* zkp_insecure_generate_private_key(
+    const zkp_params* params, const unsigned char* seed) {
+  random_source source;
+  seed_random_source(&source, seed);
+  const zkp_private_key* key = generate_private_key(params, &source);
+  memset(&source, 0, sizeof(source));
+  return key;
+}
+
 void zkp_free_private_key(const zkp_private_key* key) {
   memset(key->i, 0, key->params->d * sizeof(unsigned int));
   free(key->i);
@@ -246,12 +513,11 @@ const zkp_public_key* zkp_compute_public_key(const zkp_private_key* priv) {
   }
 
   pub->mut_self = pub;
+  pub->x0_conjugates_storage = NULL;
 
   const zkp_params* params = pub->params = priv->params;
 
-  pub->x0.domain = params->domain;
-  pub->x0.mapping = malloc(params->domain * sizeof(unsigned int));
-  if (pub->x0.mapping == NULL) {
+  if (!alloc_permutation(&pub->x0, params->domain)) {
     free(pub);
     return NULL;
   }
@@ -273,12 +539,11 @@ const zkp_public_key* zkp_import_public_key(const zkp_params* params,
   }
 
   pub->mut_self = pub;
+  pub->x0_conjugates_storage = NULL;
 
   pub->params = params;
 
-  pub->x0.domain = params->domain;
-  pub->x0.mapping = malloc(params->domain * sizeof(unsigned int));
-  if (pub->x0.mapping == NULL) {
+  if (!alloc_permutation(&pub->x0, params->domain)) {
     free(pub);
     return NULL;
   }
@@ -296,8 +561,39 @@ void zkp_export_public_key(const zkp_public_key* key,
   encode_portable_repr_perm(&key->x0, key_material);
 }
 
+int zkp_prepare_public_key(const zkp_public_key* key) {
+  const zkp_params* params = key->params;
+  // For large H, verifications conjugate x0 by tau in a single pass, which is
+  // no more work than loading a stored conjugate, since tau itself has to be
+  // loaded for its commitment anyway.
+  if (params->conjugates == NULL || key->x0_conjugates_storage != NULL) {
+    return 1;
+  }
+
+  void* storage = malloc(
+      permutation_array_alloc_size(params->domain, params->H.count));
+  if (storage == NULL) {
+    return 0;
+  }
+  permutation_array* conjugates = &key->mut_self->x0_conjugates;
+  *conjugates = (permutation_array){ .domain = params->domain,
+                                     .count = params->H.count };
+  if (PERMUTATION_IS_SMALL(conjugates)) {
+    conjugates->base.small = align_to_cache_line(storage);
+  } else {
+    conjugates->base.large = align_to_cache_line(storage);
+  }
+  for (unsigned int tau = 0; tau < params->H.count; tau++) {
+    permutation conjugate = permutation_array_element(conjugates, tau);
+    conjugate_permutation_by_array(&conjugate, &key->x0, &params->H, tau);
+  }
+  key->mut_self->x0_conjugates_storage = storage;
+  return 1;
+}
+
 void zkp_free_public_key(const zkp_public_key* key) {
-  free(key->x0.mapping);
+  free(key->x0_conjugates_storage);
+  free_permutation(&key->x0);
   free(key->mut_self);
 }
 
@@ -313,7 +609,7 @@ int zkp_is_key_pair(const zkp_private_key* priv, const zkp_public_key* pub) {
     multiply_permutation_from_array(&t, &priv->params->F, priv->i[j]);
   }
 
-  for (unsigned int i = 1; i <= priv->params->domain; i++) {
+  for (unsigned int i = 0; i < priv->params->domain; i++) {
     if (PERMUTATION_GET(&t, i) != i) {
       return 0;
     }
@@ -322,40 +618,70 @@ int zkp_is_key_pair(const zkp_private_key* priv, const zkp_public_key* pub) {
   return 1;
 }
 
+// Computes sigma_j = tau^-1 * P_j * (tau * sigma_0) for j = 1, ..., d.
+static void compute_sigma_from_prefix_products(zkp_proof* proof,
+                                               const permutation* tau) {
+  const zkp_params* params = proof->key->params;
+  zkp_round_secrets* secrets = &proof->round.secrets;
+  permutation tau_inv = proof->scratch[0];
+  permutation* tau_sigma_0 = &proof->scratch[1];
+  if (params->cyclic) {
+    tau_inv = load_permutation_from_array(
+        &params->H, (params->H.count - secrets->tau) % params->H.count,
+        &proof->scratch[0]);
+  } else {
+    inverse_permutation_into(&tau_inv, tau);
+  }
+  compose_permutations(tau_sigma_0, tau, &secrets->sigma[0]);
+  for (unsigned int j = 1; j <= params->d; j++) {
+    params->engine->compose3(&secrets->sigma[j], &tau_inv,
+                             &proof->prefix[j - 1], tau_sigma_0);
+  }
+}
+
 const unsigned char* zkp_begin_round(zkp_proof* proof) {
   const zkp_params* params = proof->key->params;
   zkp_round_secrets* secrets = &proof->round.secrets;
 
-  secrets->tau = rand_less_than(params->H.count);
-  params->G_.random_element(&secrets->sigma[0], params);
+  secrets->tau = rand_less_than_from(proof->rng, params->H.count);
+  params->G_.random_element(&secrets->sigma[0], params, proof->rng);
 
-  for (unsigned int j = 1; j <= params->d; j++) {
-    // TODO: simplify these operations
-    identity_permutation(&secrets->sigma[j]);
-    multiply_permutation_from_array_inv(&secrets->sigma[j], &params->H,
-                                        secrets->tau);
-    multiply_permutation_from_array(&secrets->sigma[j], &params->F,
-                                    proof->key->i[j - 1]);
-    multiply_permutation_from_array(&secrets->sigma[j], &params->H,
-                                    secrets->tau);
-    inverse_of_permutation(&secrets->sigma[j]);
-    multiply_permutation(&secrets->sigma[j], &secrets->sigma[j - 1]);
-  }
-
-  memset_random(secrets->k, zkp_get_commitments_size(params));
-
-  unsigned char repr[portable_repr_perm_size(params->domain)];
-  STACK_ALLOC_PERMUTATION(tau, params->domain);
-  copy_permutation_from_array(&tau, &params->H, secrets->tau);
-  encode_portable_repr_perm(&tau, repr);
-  commit_hmac_sha256(secrets->k, repr, sizeof(repr), proof->round.commitments);
+  const permutation tau =
+      load_permutation_from_array(&params->H, secrets->tau, &proof->scratch[2]);
+
+  // sigma_j = (tau^-1 * F[i_j] * tau)^-1 * sigma_{j-1}
+  if (proof->conjugates != NULL) {
+    const uint8_t* c = proof->conjugates + secrets->tau * params->d;
+    for (unsigned int j = 1; j <= params->d; j++) {
+      compose_permutations(&secrets->sigma[j], &proof->f_inv[c[j - 1]],
+                           &secrets->sigma[j - 1]);
+    }
+  } else {
+    compute_sigma_from_prefix_products(proof, &tau);
+  }
+
+  memset_random_from(proof->rng, secrets->k,
+                     zkp_get_commitments_size(params));
 
+  // All d + 2 commitments are computed at once, which allows processing them in
+  // parallel.
+  const unsigned int repr_size = portable_repr_perm_size(params->domain);
+  const unsigned int n_commitments = params->d + 2;
+  const unsigned char* keys[n_commitments];
+  const unsigned char* messages[n_commitments];
+  unsigned char repr[repr_size];
+  messages[0] = portable_repr_tau(params, secrets->tau, &tau, repr);
   for (unsigned int i = 0; i <= params->d; i++) {
-    encode_portable_repr_perm(&secrets->sigma[i], repr);
-    commit_hmac_sha256(secrets->k + (i + 1) * COMMITMENT_SIZE, repr,
-                       sizeof(repr),
-                       proof->round.commitments + (i + 1) * COMMITMENT_SIZE);
+    unsigned char* sigma_repr = proof->round.sigma_reprs == NULL
+                                    ? NULL
+                                    : proof->round.sigma_reprs + i * repr_size;
+    messages[i + 1] = portable_repr_perm(&secrets->sigma[i], sigma_repr);
   }
+  for (unsigned int i = 0; i < n_commitments; i++) {
+    keys[i] = secrets->k + i * COMMITMENT_SIZE;
+  }
+  commit_batch(&proof->commitment, keys, messages, repr_size,
+               n_commitments, proof->round.commitments);
 
   proof->round.answer.q = Q_NONE;
 
@@ -373,7 +699,17 @@ zkp_verification* zkp_new_verification(const zkp_public_key* key) {
     return NULL;
   }
 
+  if (!preallocate_scratch(key->params, verification->scratch)) {
+    free_preallocated_answer(&verification->imported_answer);
+    free(verification);
+    return NULL;
+  }
+
   verification->key = key;
+  verification->cache_entry = NULL;
+  init_commitment_engine(&verification->commitment,
+                         key->params->commitment);
+  verification->rng = NULL;
   verification->q = Q_NONE;
   verification->n_successful_rounds = 0;
 
@@ -381,7 +717,8 @@ zkp_verification* zkp_new_verification(const zkp_public_key* key) {
 }
 
 unsigned int zkp_choose_question(zkp_verification* verification) {
-  return (verification->q = rand_less_than(verification->key->params->d + 1));
+  return (verification->q = rand_less_than_from(
+              verification->rng, verification->key->params->d + 1));
 }
 
 zkp_answer* zkp_get_answer(zkp_proof* proof, unsigned int q) {
@@ -402,17 +739,24 @@ zkp_answer* zkp_get_answer(zkp_proof* proof, unsigned int q) {
         proof->round.secrets.k + COMMITMENT_SIZE * (proof->key->params->d + 1),
         COMMITMENT_SIZE);
   } else if (q <= proof->key->params->d) {
-    STACK_ALLOC_PERMUTATION(f_i_q_tau, proof->key->params->domain);
-    identity_permutation(&f_i_q_tau);
-    multiply_permutation_from_array_inv(&f_i_q_tau, &proof->key->params->H,
-                                        proof->round.secrets.tau);
-    multiply_permutation_from_array(&f_i_q_tau, &proof->key->params->F,
-                                    proof->key->i[q - 1]);
-    multiply_permutation_from_array(&f_i_q_tau, &proof->key->params->H,
-                                    proof->round.secrets.tau);
-    int ok = index_of_permutation_in_array(&f_i_q_tau, &proof->key->params->F,
-                                           &proof->round.answer.q_ne_0.f);
-    assert(ok);
+    const zkp_params* params = proof->key->params;
+    const unsigned int i_q = proof->key->i[q - 1];
+    if (proof->conjugates != NULL) {
+      proof->round.answer.q_ne_0.f =
+          proof->conjugates[proof->round.secrets.tau * params->d + q - 1];
+    } else if (params->cyclic) {
+      proof->round.answer.q_ne_0.f =
+          (i_q + proof->round.secrets.tau) % params->F.count;
+    } else {
+      const permutation tau = load_permutation_from_array(
+          &params->H, proof->round.secrets.tau, &proof->scratch[1]);
+      permutation* f_i_q_tau = &proof->scratch[0];
+      params->engine->conjugate(f_i_q_tau, &params->F, i_q, &tau);
+      int ok = index_of_permutation_in_array(f_i_q_tau, &params->F,
+                                             &proof->round.answer.q_ne_0.f);
+      assert(ok);
+      (void) ok;
+    }
     copy_permutation_into(&proof->round.answer.q_ne_0.sigma_q,
                           &proof->round.secrets.sigma[q]);
     memcpy(proof->round.answer.q_ne_0.k_q_minus_1,
@@ -441,34 +785,34 @@ int zkp_verify(zkp_verification* verification, const unsigned char* commitments,
       return 0;
     }
 
-    STACK_ALLOC_PERMUTATION(sigma_d, params->domain);
-    identity_permutation(&sigma_d);
-    multiply_permutation_from_array_inv(&sigma_d, &params->H,
-                                        answer->q_eq_0.tau);
-    multiply_permutation(&sigma_d, &verification->key->x0);
-    multiply_permutation_from_array(&sigma_d, &params->H, answer->q_eq_0.tau);
-    multiply_permutation(&sigma_d, &answer->q_eq_0.sigma_0);
-
-    unsigned char repr[portable_repr_perm_size(params->domain)];
-    STACK_ALLOC_PERMUTATION(tau, params->domain);
-    copy_permutation_from_array(&tau, &params->H, answer->q_eq_0.tau);
-    encode_portable_repr_perm(&tau, repr);
-
-    unsigned char md[COMMITMENT_SIZE];
-    commit_hmac_sha256(answer->q_eq_0.k_star, repr, sizeof(repr), md);
-    if (memcmp(md, commitments, COMMITMENT_SIZE) != 0) {
-      return 0;
-    }
+    const permutation tau = load_permutation_from_array(
+        &params->H, answer->q_eq_0.tau, &verification->scratch[1]);
 
-    encode_portable_repr_perm(&answer->q_eq_0.sigma_0, repr);
-    commit_hmac_sha256(answer->q_eq_0.k_0, repr, sizeof(repr), md);
-    if (memcmp(md, commitments + COMMITMENT_SIZE, COMMITMENT_SIZE) != 0) {
-      return 0;
+    // sigma_d = tau^-1 * x0 * tau * sigma_0
+    permutation* sigma_d = &verification->scratch[0];
+    if (verification->key->x0_conjugates_storage != NULL) {
+      params->engine->compose(sigma_d, &verification->key->x0_conjugates,
+                              answer->q_eq_0.tau, &answer->q_eq_0.sigma_0);
+    } else {
+      params->engine->conjugate_compose(sigma_d, &verification->key->x0, &tau,
+                                        &answer->q_eq_0.sigma_0);
     }
 
-    encode_portable_repr_perm(&sigma_d, repr);
-    commit_hmac_sha256(answer->q_eq_0.k_d, repr, sizeof(repr), md);
-    if (memcmp(md, commitments + COMMITMENT_SIZE * (1 + params->d),
+    const unsigned int repr_size = portable_repr_perm_size(params->domain);
+    unsigned char reprs[3][repr_size];
+    const unsigned char* keys[] = { answer->q_eq_0.k_star, answer->q_eq_0.k_0,
+                                    answer->q_eq_0.k_d };
+    const unsigned char* messages[] = {
+      portable_repr_tau(params, answer->q_eq_0.tau, &tau, reprs[0]),
+      portable_repr_perm(&answer->q_eq_0.sigma_0, reprs[1]),
+      portable_repr_perm(sigma_d, reprs[2]),
+    };
+    unsigned char md[3][COMMITMENT_SIZE];
+    commit_batch(&verification->commitment, keys, messages, repr_size,
+                 3, md[0]);
+    if (memcmp(md[0], commitments, COMMITMENT_SIZE) != 0 ||
+        memcmp(md[1], commitments + COMMITMENT_SIZE, COMMITMENT_SIZE) != 0 ||
+        memcmp(md[2], commitments + COMMITMENT_SIZE * (1 + params->d),
                COMMITMENT_SIZE) != 0) {
       return 0;
     }
@@ -477,23 +821,24 @@ int zkp_verify(zkp_verification* verification, const unsigned char* commitments,
       return 0;
     }
 
-    STACK_ALLOC_PERMUTATION(sigma_q_minus_1, params->domain);
-    copy_permutation_from_array(&sigma_q_minus_1, &params->F, answer->q_ne_0.f);
-    multiply_permutation(&sigma_q_minus_1, &answer->q_ne_0.sigma_q);
-
-    unsigned char repr[portable_repr_perm_size(params->domain)];
-    encode_portable_repr_perm(&answer->q_ne_0.sigma_q, repr);
-
-    unsigned char md[COMMITMENT_SIZE];
-    commit_hmac_sha256(answer->q_ne_0.k_q, repr, sizeof(repr), md);
-    if (memcmp(md, commitments + COMMITMENT_SIZE * (1 + answer->q),
-               COMMITMENT_SIZE) != 0) {
-      return 0;
-    }
-
-    encode_portable_repr_perm(&sigma_q_minus_1, repr);
-    commit_hmac_sha256(answer->q_ne_0.k_q_minus_1, repr, sizeof(repr), md);
-    if (memcmp(md, commitments + COMMITMENT_SIZE * answer->q,
+    permutation* sigma_q_minus_1 = &verification->scratch[0];
+    params->engine->compose(sigma_q_minus_1, &params->F, answer->q_ne_0.f,
+                            &answer->q_ne_0.sigma_q);
+
+    const unsigned int repr_size = portable_repr_perm_size(params->domain);
+    unsigned char reprs[2][repr_size];
+    const unsigned char* keys[] = { answer->q_ne_0.k_q,
+                                    answer->q_ne_0.k_q_minus_1 };
+    const unsigned char* messages[] = {
+      portable_repr_perm(&answer->q_ne_0.sigma_q, reprs[0]),
+      portable_repr_perm(sigma_q_minus_1, reprs[1]),
+    };
+    unsigned char md[2][COMMITMENT_SIZE];
+    commit_batch(&verification->commitment, keys, messages, repr_size,
+                 2, md[0]);
+    if (memcmp(md[0], commitments + COMMITMENT_SIZE * (1 + answer->q),
+               COMMITMENT_SIZE) != 0 ||
+        memcmp(md[1], commitments + COMMITMENT_SIZE * answer->q,
                COMMITMENT_SIZE) != 0) {
       return 0;
     }
@@ -506,6 +851,30 @@ int zkp_verify(zkp_verification* verification, const unsigned char* commitments,
   return 1;
 }
 
+void zkp_export_answer(const zkp_params* params, const zkp_answer* answer,
+                       unsigned char* bytes) {
+  const unsigned int index_bytes = tau_or_f_size(params);
+  const unsigned int index =
+      answer->q == 0 ? answer->q_eq_0.tau : answer->q_ne_0.f;
+  for (unsigned int i = 0; i < index_bytes; i++) {
+    bytes[i] = (unsigned char) (index >> (i * BITS_PER_BYTE));
+  }
+  bytes += index_bytes;
+
+  if (answer->q == 0) {
+    encode_portable_repr_perm(&answer->q_eq_0.sigma_0, bytes);
+    bytes += portable_repr_perm_size(params->domain);
+    memcpy(bytes, answer->q_eq_0.k_star, COMMITMENT_SIZE);
+    memcpy(bytes + COMMITMENT_SIZE, answer->q_eq_0.k_0, COMMITMENT_SIZE);
+    memcpy(bytes + 2 * COMMITMENT_SIZE, answer->q_eq_0.k_d, COMMITMENT_SIZE);
+  } else {
+    encode_portable_repr_perm(&answer->q_ne_0.sigma_q, bytes);
+    bytes += portable_repr_perm_size(params->domain);
+    memcpy(bytes, answer->q_ne_0.k_q_minus_1, COMMITMENT_SIZE);
+    memcpy(bytes + COMMITMENT_SIZE, answer->q_ne_0.k_q, COMMITMENT_SIZE);
+  }
+}
+
 static int import_answer(zkp_verification* verification,
                          const unsigned char* bytes, unsigned int answer_size) {
   zkp_answer* answer = &verification->imported_answer;
@@ -588,6 +957,48 @@ double zkp_get_impersonation_probability(zkp_verification* verification) {
 }
 
 void zkp_free_verification(zkp_verification* verification) {
+  if (verification->cache_entry != NULL &&
+      release_cached_verification(verification)) {
+    return;
+  }
   free_preallocated_answer(&verification->imported_answer);
+  free_preallocated_scratch(verification->scratch);
+  free(verification->rng);
   free(verification);
 }
+
+static const commitment_scheme* get_commitment_scheme(
+    zkp_commitment_scheme scheme) {
+  switch (scheme) {
+    case ZKP_COMMITMENT_HMAC_SHA256:
+      return &commitment_hmac_sha256;
+    case ZKP_COMMITMENT_SHA256:
+      return &commitment_sha256;
+  }
+  return NULL;
+}
+
+int zkp_set_proof_commitment_scheme(zkp_proof* proof,
+                                    zkp_commitment_scheme scheme) {
+  const commitment_scheme* commitment = get_commitment_scheme(scheme);
+  if (commitment == NULL) {
+    return 0;
+  }
+  init_commitment_engine(&proof->commitment, commitment);
+  return 1;
+}
+
+int zkp_set_verification_commitment_scheme(zkp_verification* verification,
+                                           zkp_commitment_scheme scheme) {
+  const commitment_scheme* commitment = get_commitment_scheme(scheme);
+  if (commitment == NULL) {
+    return 0;
+  }
+  init_commitment_engine(&verification->commitment, commitment);
+  return 1;
+}
+
+int zkp_insecure_seed_verification(zkp_verification* verification,
+                                   const unsigned char* seed) {
+  return seed_context(&verification->rng, seed);
+}
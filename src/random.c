@@ -1,36 +1,277 @@
+#if defined(ZKP_BUILTIN_CRYPTO) && !defined(__WASM__)
+#define _DEFAULT_SOURCE
+#endif
+
 #include "random.h"
 
-#include <limits.h>
+#include <string.h>
 
 #ifndef __WASM__
 
-#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#ifdef ZKP_BUILTIN_CRYPTO
+
+#include <unistd.h>
+
+// Only seeds are drawn from the system, which never exceed the 256 bytes that
+// getentropy returns at once. Since each seed keys a long keystream, failures
+// abort the process, regardless of NDEBUG.
+static inline void crypto_rand_bytes(unsigned char* ptr, size_t n) {
+  if (getentropy(ptr, n) != 0) {
+    abort();
+  }
+}
+
+#else
+
 #include <openssl/rand.h>
 
 static inline void crypto_rand_bytes(unsigned char* ptr, size_t n) {
-  int ret = RAND_bytes(ptr, n);
-  assert(ret);
+  if (RAND_bytes(ptr, n) != 1) {
+    abort();
+  }
 }
 
+#endif
+
+#define THREAD_LOCAL __thread
+
 #else
 
 __attribute__((import_module("crypto"), import_name("randomBytes"))) extern void
 crypto_rand_bytes(unsigned char* ptr, size_t n);
 
+#define THREAD_LOCAL
+
+#endif
+
+#define CHACHA20_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define CHACHA20_QUARTER_ROUND(a, b, c, d)                                     \
+  do {                                                                         \
+    a += b;                                                                    \
+    d = CHACHA20_ROTL(d ^ a, 16);                                              \
+    c += d;                                                                    \
+    b = CHACHA20_ROTL(b ^ c, 12);                                              \
+    a += b;                                                                    \
+    d = CHACHA20_ROTL(d ^ a, 8);                                               \
+    c += d;                                                                    \
+    b = CHACHA20_ROTL(b ^ c, 7);                                               \
+  } while (0)
+
+static inline uint32_t load_le32(const unsigned char* p) {
+  return (uint32_t) p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 |
+         (uint32_t) p[3] << 24;
+}
+
+static inline void store_le32(unsigned char* p, uint32_t v) {
+  p[0] = (unsigned char) v;
+  p[1] = (unsigned char) (v >> 8);
+  p[2] = (unsigned char) (v >> 16);
+  p[3] = (unsigned char) (v >> 24);
+}
+
+void chacha20_block(const unsigned char key[CHACHA20_KEY_SIZE],
+                    uint32_t counter,
+                    const unsigned char nonce[CHACHA20_NONCE_SIZE],
+                    unsigned char out[CHACHA20_BLOCK_SIZE]) {
+  uint32_t input[16] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+  for (unsigned int i = 0; i < 8; i++) {
+    input[4 + i] = load_le32(key + 4 * i);
+  }
+  input[12] = counter;
+  for (unsigned int i = 0; i < 3; i++) {
+    input[13 + i] = load_le32(nonce + 4 * i);
+  }
+
+  uint32_t x[16];
+  memcpy(x, input, sizeof(x));
+  for (unsigned int i = 0; i < 10; i++) {
+    CHACHA20_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+    CHACHA20_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+    CHACHA20_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+    CHACHA20_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+    CHACHA20_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+    CHACHA20_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+    CHACHA20_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+    CHACHA20_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+  }
+  for (unsigned int i = 0; i < 16; i++) {
+    store_le32(out + 4 * i, x[i] + input[i]);
+  }
+}
+
+static THREAD_LOCAL random_source thread_source;
+
+// Incremented in each child process, which must not continue the keystreams
+// of its parent.
+static unsigned int fork_generation = 0;
+
+#ifndef __WASM__
+static void on_fork_child(void) {
+  fork_generation++;
+}
+
+static pthread_once_t fork_handler_registered = PTHREAD_ONCE_INIT;
+
+// Without the handler, a child process would silently continue the keystreams
+// of its parent.
+static void register_fork_handler(void) {
+  if (pthread_atfork(NULL, NULL, on_fork_child) != 0) {
+    abort();
+  }
+}
 #endif
 
+static void reseed(random_source* state) {
+#ifndef __WASM__
+  pthread_once(&fork_handler_registered, register_fork_handler);
+#endif
+  unsigned char seed[CHACHA20_KEY_SIZE];
+  crypto_rand_bytes(seed, sizeof(seed));
+  for (unsigned int i = 0; i < CHACHA20_KEY_SIZE; i++) {
+    state->key[i] ^= seed[i];
+  }
+  memset(seed, 0, sizeof(seed));
+  // Discard any buffered output, which may be shared with another process.
+  memset(state->buffer, 0, sizeof(state->buffer));
+  state->available = 0;
+  state->output_since_reseed = 0;
+  state->seeded_generation = fork_generation + 1;
+}
+
+void seed_random_source(random_source* source,
+                        const unsigned char seed[RANDOM_SEED_SIZE]) {
+  memcpy(source->key, seed, CHACHA20_KEY_SIZE);
+  memset(source->buffer, 0, sizeof(source->buffer));
+  source->available = 0;
+  source->output_since_reseed = 0;
+  source->seeded_generation = 0;
+  source->deterministic = 1;
+}
+
+static void refill(random_source* state) {
+  if (!state->deterministic &&
+      (state->seeded_generation != fork_generation + 1 ||
+       state->output_since_reseed >= RANDOM_RESEED_INTERVAL)) {
+    reseed(state);
+  }
+  static const unsigned char nonce[CHACHA20_NONCE_SIZE];
+  for (unsigned int i = 0; i < RANDOM_BUFFER_BLOCKS; i++) {
+    chacha20_block(state->key, i, nonce,
+                   state->buffer + i * CHACHA20_BLOCK_SIZE);
+  }
+  memcpy(state->key, state->buffer, CHACHA20_KEY_SIZE);
+  memset(state->buffer, 0, CHACHA20_KEY_SIZE);
+  state->available = RANDOM_BUFFER_SIZE - CHACHA20_KEY_SIZE;
+  state->output_since_reseed += state->available;
+}
+
+void memset_random_from(random_source* source, void* ptr, size_t n) {
+  random_source* state = source != NULL ? source : &thread_source;
+  if (!state->deterministic &&
+      state->seeded_generation != fork_generation + 1) {
+    refill(state);
+  }
+  unsigned char* out = ptr;
+  while (n != 0) {
+    if (state->available == 0) {
+      refill(state);
+    }
+    const size_t chunk = n < state->available ? n : state->available;
+    unsigned char* src = state->buffer + RANDOM_BUFFER_SIZE - state->available;
+    memcpy(out, src, chunk);
+    memset(src, 0, chunk);
+    state->available -= (unsigned int) chunk;
+    out += chunk;
+    n -= chunk;
+  }
+}
+
 void memset_random(void* ptr, size_t n) {
-  crypto_rand_bytes((unsigned char*) ptr, n);
+  memset_random_from(NULL, ptr, n);
+}
+
+// Random words are drawn from a source in batches of up to this size.
+#define RANDOM_WORDS_BATCH 64
+
+typedef struct {
+  random_source* source;
+  uint32_t words[RANDOM_WORDS_BATCH];
+  unsigned int next;
+  unsigned int end;
+  // The number of words that are still expected to be needed, which limits the
+  // size of the next batch.
+  size_t wanted;
+} random_words;
+
+static inline uint32_t next_random_word(random_words* w) {
+  if (w->next == w->end) {
+    w->end = w->wanted == 0
+                 ? 1
+                 : (w->wanted < RANDOM_WORDS_BATCH ? (unsigned int) w->wanted
+                                                   : RANDOM_WORDS_BATCH);
+    memset_random_from(w->source, w->words, w->end * sizeof(uint32_t));
+    w->next = 0;
+  }
+  if (w->wanted != 0) {
+    w->wanted--;
+  }
+  return w->words[w->next++];
+}
+
+// Returns a uniformly random integer that is less than s, which must not be
+// zero. The product of a random word and s is biased only if its low half is
+// less than 2^32 mod s, which requires a division in rare cases only (Lemire,
+// "Fast random integer generation in an interval", 2019).
+static inline uint32_t bounded_random_word(random_words* w, uint32_t s) {
+  uint64_t m = (uint64_t) next_random_word(w) * s;
+  if ((uint32_t) m < s) {
+    const uint32_t threshold = (0u - s) % s;
+    while ((uint32_t) m < threshold) {
+      m = (uint64_t) next_random_word(w) * s;
+    }
+  }
+  return (uint32_t) (m >> 32);
 }
 
-static inline int is_unbiased(unsigned int value, unsigned int excl_max) {
-  return value <= (UINT_MAX - (UINT_MAX % excl_max) - 1);
+unsigned int rand_less_than_from(random_source* source,
+                                 unsigned int excl_max) {
+  uint32_t word;
+  memset_random_from(source, &word, sizeof(word));
+  uint64_t m = (uint64_t) word * excl_max;
+  if ((uint32_t) m < excl_max) {
+    const uint32_t threshold = (0u - excl_max) % excl_max;
+    while ((uint32_t) m < threshold) {
+      memset_random_from(source, &word, sizeof(word));
+      m = (uint64_t) word * excl_max;
+    }
+  }
+  return (unsigned int) (m >> 32);
 }
 
 unsigned int rand_less_than(unsigned int excl_max) {
-  unsigned int ret;
-  do {
-    memset_random(&ret, sizeof(ret));
-  } while (!is_unbiased(ret, excl_max));
-  return ret % excl_max;
+  return rand_less_than_from(NULL, excl_max);
 }
+
+// Inside-out Fisher-Yates, which writes each permutation exactly once instead
+// of shuffling the identity in place.
+#define DEFINE_RANDOM_PERMUTATIONS(name, type)                                 \
+  void name(random_source* source, type* out, size_t stride, unsigned int n,   \
+            unsigned int count) {                                              \
+    random_words w = { .source = source,                                       \
+                       .wanted = (size_t) (n - 1) * count };                   \
+    for (unsigned int k = 0; k < count; k++, out += stride) {                  \
+      for (unsigned int i = 0; i < n; i++) {                                   \
+        const uint32_t j = i == 0 ? 0 : bounded_random_word(&w, i + 1);       \
+        out[i] = out[j];                                                       \
+        out[j] = (type) (i + 1);                                               \
+      }                                                                        \
+    }                                                                          \
+    memset(w.words, 0, sizeof(w.words));                                       \
+  }
+
+DEFINE_RANDOM_PERMUTATIONS(random_permutations_small, uint8_t)
+DEFINE_RANDOM_PERMUTATIONS(random_permutations_large, uint16_t)
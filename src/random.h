@@ -1,5 +1,67 @@
+#include <stdint.h>
 #include <stdlib.h>
 
-void memset_random(void* ptr, size_t n);
+#define CHACHA20_KEY_SIZE 32
+#define CHACHA20_NONCE_SIZE 12
+#define CHACHA20_BLOCK_SIZE 64
+
+// Computes a single block of the ChaCha20 keystream, as specified in RFC 8439.
+void chacha20_block(const unsigned char key[CHACHA20_KEY_SIZE],
+                    uint32_t counter,
+                    const unsigned char nonce[CHACHA20_NONCE_SIZE],
+                    unsigned char out[CHACHA20_BLOCK_SIZE]);
+
+// Random bytes are generated this many ChaCha20 blocks at a time.
+#define RANDOM_BUFFER_BLOCKS 16
+#define RANDOM_BUFFER_SIZE (RANDOM_BUFFER_BLOCKS * CHACHA20_BLOCK_SIZE)
+
+// The key of a source that is not deterministic is mixed with fresh bytes from
+// the system source after this many bytes of output.
+#define RANDOM_RESEED_INTERVAL (1 << 20)
+
+#define RANDOM_SEED_SIZE CHACHA20_KEY_SIZE
+
+// A ChaCha20 keystream, which is generated RANDOM_BUFFER_BLOCKS blocks at a
+// time. The first bytes of each batch replace the key, and bytes are erased as
+// soon as they have been handed out, such that the state never reveals any
+// output that has been used already.
+typedef struct {
+  unsigned char key[CHACHA20_KEY_SIZE];
+  unsigned char buffer[RANDOM_BUFFER_SIZE];
+  // The number of unused bytes at the end of the buffer.
+  unsigned int available;
+  unsigned long output_since_reseed;
+  // The fork generation when the source was seeded from the system source,
+  // plus one, such that zero means that it has not been seeded yet.
+  unsigned int seeded_generation;
+  // If not zero, the keystream only depends on the seed, and is never reseeded.
+  int deterministic;
+} random_source;
 
+// Makes the keystream of the source depend only on the given seed. This is
+// insecure unless the seed is secret and never reused, and only intended for
+// reproducible benchmarks and test vectors.
+void seed_random_source(random_source* source,
+                        const unsigned char seed[RANDOM_SEED_SIZE]);
+
+// The following functions draw random bytes from the given source, or, if the
+// source is NULL, from the source of the calling thread. Each thread's source
+// is seeded from the system source, and reseeded periodically and in child
+// processes after fork.
+void memset_random_from(random_source* source, void* ptr, size_t n);
+
+// Returns a uniformly random integer that is less than excl_max.
+unsigned int rand_less_than_from(random_source* source, unsigned int excl_max);
+
+// Stores count uniformly random permutations of the labels 1, ..., n, the k-th
+// of which starts at out + k * stride. All random words are drawn in batches.
+void random_permutations_small(random_source* source, uint8_t* out,
+                               size_t stride, unsigned int n,
+                               unsigned int count);
+void random_permutations_large(random_source* source, uint16_t* out,
+                               size_t stride, unsigned int n,
+                               unsigned int count);
+
+// Shorthands that draw from the source of the calling thread.
+void memset_random(void* ptr, size_t n);
 unsigned int rand_less_than(unsigned int excl_max);
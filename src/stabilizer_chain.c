@@ -0,0 +1,357 @@
+#include <stdlib.h>
+
+#include "internals.h"
+
+// The chain is built by the randomized Schreier-Sims algorithm: random group
+// elements are sifted through the partial chain, and each element that does
+// not sift to the identity extends it. The chain is complete once this many
+// consecutive random elements have sifted to the identity. If it was not, each
+// of them would have done so with probability at most 1/2.
+#define CHAIN_CONFIRMATIONS 64
+
+// The minimum number of elements of the product replacement state, excluding
+// the accumulator, and the number of steps that are discarded initially.
+#define PRODUCT_REPLACEMENT_SLOTS 10
+#define PRODUCT_REPLACEMENT_WARMUP 64
+
+// Consecutive levels are merged as long as their transversals have at most
+// this many products, which shortens the product for a random element.
+#define MAX_MERGED_TRANSVERSAL 256
+
+// The chain does not depend on the random choices, only its transversals do.
+// Using a fixed seed makes them, and thus all seeded proofs, reproducible.
+static const unsigned char chain_seed[RANDOM_SEED_SIZE] = "stabilizer chain";
+
+typedef struct {
+  unsigned int base_point;
+  unsigned int orbit_size;
+  // orbit_index[p] is one more than the index of p in the orbit, or zero.
+  unsigned int* orbit_index;
+  // transversal[k] maps the base point to the k-th point of the orbit.
+  permutation* transversal;
+} chain_level;
+
+typedef struct {
+  unsigned int domain;
+  unsigned int n_levels;
+  chain_level* levels;
+  unsigned int n_generators;
+  permutation* generators;
+} partial_chain;
+
+static int fixes_base_prefix(const partial_chain* chain, const permutation* g,
+                             unsigned int n_points) {
+  for (unsigned int l = 0; l < n_points; l++) {
+    const unsigned int b = chain->levels[l].base_point;
+    if (PERMUTATION_GET(g, b) != b) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Extends the orbit of a level until it is closed under all generators that
+// fix the base points of the previous levels.
+static int close_orbit(partial_chain* chain, unsigned int l) {
+  chain_level* level = &chain->levels[l];
+  for (unsigned int k = 0; k < level->orbit_size; k++) {
+    const unsigned int p = PERMUTATION_GET(&level->transversal[k],
+                                           level->base_point);
+    for (unsigned int i = 0; i < chain->n_generators; i++) {
+      const permutation* s = &chain->generators[i];
+      const unsigned int q = PERMUTATION_GET(s, p);
+      if (level->orbit_index[q] != 0 || !fixes_base_prefix(chain, s, l)) {
+        continue;
+      }
+      permutation* t = &level->transversal[level->orbit_size];
+      if (!alloc_permutation(t, chain->domain)) {
+        return 0;
+      }
+      compose_permutations(t, &level->transversal[k], s);
+      level->orbit_index[q] = ++level->orbit_size;
+    }
+  }
+  return 1;
+}
+
+static int add_level(partial_chain* chain, unsigned int base_point) {
+  chain_level* level = &chain->levels[chain->n_levels];
+  level->base_point = base_point;
+  level->orbit_size = 0;
+  level->orbit_index = calloc(chain->domain, sizeof(unsigned int));
+  level->transversal = malloc(chain->domain * sizeof(permutation));
+  if (level->orbit_index == NULL || level->transversal == NULL ||
+      !alloc_permutation(&level->transversal[0], chain->domain)) {
+    free(level->orbit_index);
+    free(level->transversal);
+    return 0;
+  }
+  identity_permutation(&level->transversal[0]);
+  level->orbit_index[base_point] = ++level->orbit_size;
+  chain->n_levels++;
+  return 1;
+}
+
+// Adds a generator and extends the chain accordingly. The generator must fix
+// the base points of the first l levels.
+static int add_generator(partial_chain* chain, const permutation* g,
+                         unsigned int l) {
+  assert(chain->n_generators < chain->domain * chain->domain);
+  permutation* s = &chain->generators[chain->n_generators];
+  if (!alloc_permutation(s, chain->domain)) {
+    return 0;
+  }
+  copy_permutation_into(s, g);
+  chain->n_generators++;
+  if (l == chain->n_levels) {
+    unsigned int moved = 0;
+    while (PERMUTATION_GET(s, moved) == moved) {
+      moved++;
+    }
+    if (!add_level(chain, moved)) {
+      return 0;
+    }
+  }
+  for (unsigned int k = 0; k <= l; k++) {
+    if (!close_orbit(chain, k)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Replaces g by its residue after sifting it through the chain, and returns
+// the level at which the residue left the chain, or the number of levels if
+// g is an element of the group that the chain describes.
+static unsigned int sift(const partial_chain* chain, permutation* g) {
+  for (unsigned int l = 0; l < chain->n_levels; l++) {
+    const chain_level* level = &chain->levels[l];
+    const unsigned int k = level->orbit_index[PERMUTATION_GET(
+        g, level->base_point)];
+    if (k == 0) {
+      return l;
+    }
+    compose_permutation_with_inverse(g, g, &level->transversal[k - 1]);
+  }
+  return chain->n_levels;
+}
+
+static int is_identity(const permutation* g) {
+  for (unsigned int x = 0; x < g->domain; x++) {
+    if (PERMUTATION_GET(g, x) != x) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Sifts g, which is modified, and extends the chain if g is not an element of
+// the group that the chain describes. Sets *extended accordingly.
+static int sift_and_extend(partial_chain* chain, permutation* g,
+                           int* extended) {
+  const unsigned int l = sift(chain, g);
+  *extended = l != chain->n_levels || !is_identity(g);
+  return !*extended || add_generator(chain, g, l);
+}
+
+// Returns the next element of the product replacement algorithm, which is
+// close to uniformly distributed in the group generated by the initial state.
+// The state consists of n_slots elements followed by the accumulator.
+static void next_random_element(permutation* state, unsigned int n_slots,
+                                random_source* source) {
+  const unsigned int i = rand_less_than_from(source, n_slots);
+  unsigned int j = rand_less_than_from(source, n_slots - 1);
+  j += j >= i;
+  if (rand_less_than_from(source, 2)) {
+    compose_permutations(&state[i], &state[i], &state[j]);
+  } else {
+    compose_permutation_with_inverse(&state[i], &state[i], &state[j]);
+  }
+  multiply_permutation(&state[n_slots], &state[i]);
+}
+
+// Copies the transversals of the partial chain into the given chain, merging
+// consecutive levels as long as the product of their orbit sizes does not
+// exceed MAX_MERGED_TRANSVERSAL. The merged transversal of levels l, ..., m
+// consists of all products t_m * ... * t_l of elements of their transversals.
+static unsigned int end_of_merged_level(const partial_chain* chain,
+                                        unsigned int l, unsigned int* size) {
+  *size = chain->levels[l].orbit_size;
+  unsigned int m = l + 1;
+  for (; m < chain->n_levels &&
+         *size * chain->levels[m].orbit_size <= MAX_MERGED_TRANSVERSAL;
+       m++) {
+    *size *= chain->levels[m].orbit_size;
+  }
+  return m;
+}
+
+static int pack_chain(stabilizer_chain* out, const partial_chain* chain) {
+  unsigned int n_levels = 0, count = 0;
+  for (unsigned int l = 0, size; l < chain->n_levels; n_levels++) {
+    l = end_of_merged_level(chain, l, &size);
+    count += size;
+  }
+
+  unsigned int* base = malloc(chain->n_levels * sizeof(unsigned int));
+  unsigned int* first_base = malloc((n_levels + 1) * sizeof(unsigned int));
+  unsigned int* offsets = malloc((n_levels + 1) * sizeof(unsigned int));
+  permutation_array transversals = { .domain = chain->domain, .count = count };
+  void* storage = alloc_permutation_array_base(chain->domain, count);
+  if (base == NULL || first_base == NULL || offsets == NULL ||
+      storage == NULL) {
+    free(base);
+    free(first_base);
+    free(offsets);
+    return 0;
+  }
+  if (PERMUTATION_IS_SMALL(&transversals)) {
+    transversals.base.small = storage;
+  } else {
+    transversals.base.large = storage;
+  }
+
+  first_base[0] = 0;
+  offsets[0] = 0;
+  for (unsigned int l = 0, merged = 0; l < chain->n_levels; merged++) {
+    unsigned int size;
+    const unsigned int m = end_of_merged_level(chain, l, &size);
+    for (unsigned int k = 0; k < size; k++) {
+      permutation t = permutation_array_element(&transversals,
+                                                offsets[merged] + k);
+      identity_permutation(&t);
+      // The digits of k in the mixed radix of the orbit sizes select one
+      // element of each transversal.
+      for (unsigned int i = m, r = k; i-- > l;) {
+        const chain_level* level = &chain->levels[i];
+        multiply_permutation(&t, &level->transversal[r % level->orbit_size]);
+        r /= level->orbit_size;
+      }
+    }
+    for (; l < m; l++) {
+      base[l] = chain->levels[l].base_point;
+    }
+    first_base[merged + 1] = m;
+    offsets[merged + 1] = offsets[merged] + size;
+  }
+
+  out->n_levels = n_levels;
+  out->base = base;
+  out->first_base = first_base;
+  out->offsets = offsets;
+  out->transversals = transversals;
+  return 1;
+}
+
+static void free_partial_chain(partial_chain* chain) {
+  for (unsigned int l = 0; l < chain->n_levels; l++) {
+    for (unsigned int k = 0; k < chain->levels[l].orbit_size; k++) {
+      free_permutation(&chain->levels[l].transversal[k]);
+    }
+    free(chain->levels[l].transversal);
+    free(chain->levels[l].orbit_index);
+  }
+  for (unsigned int i = 0; i < chain->n_generators; i++) {
+    free_permutation(&chain->generators[i]);
+  }
+  free(chain->levels);
+  free(chain->generators);
+}
+
+int build_stabilizer_chain(stabilizer_chain* out,
+                           const permutation_array* const* generators,
+                           unsigned int n_arrays) {
+  const unsigned int n = generators[0]->domain;
+  // Each generator that is added extends the orbit of a level or adds a level,
+  // which can happen fewer than n^2 times in total.
+  const unsigned int max_generators = n * n;
+  partial_chain chain = { .domain = n };
+  chain.levels = malloc(n * sizeof(chain_level));
+  chain.generators = malloc(max_generators * sizeof(permutation));
+
+  // Each given generator gets a slot of its own, such that the state generates
+  // the same group as the given generators, and random elements are drawn from
+  // all of it.
+  unsigned int n_given = 0;
+  for (unsigned int a = 0; a < n_arrays; a++) {
+    n_given += generators[a]->count;
+  }
+  assert(n_given != 0);
+  const unsigned int n_slots = n_given > PRODUCT_REPLACEMENT_SLOTS
+                                   ? n_given
+                                   : PRODUCT_REPLACEMENT_SLOTS;
+  permutation* state = malloc((n_slots + 1) * sizeof(permutation));
+  unsigned int n_state = 0;
+  STACK_ALLOC_PERMUTATION(g, n);
+  int ok = chain.levels != NULL && chain.generators != NULL && state != NULL;
+  for (; ok && n_state <= n_slots; n_state++) {
+    ok = alloc_permutation(&state[n_state], n);
+  }
+
+  // The given generators are sifted first, such that the chain contains all of
+  // them, and thus describes their group once random elements no longer
+  // extend it.
+  unsigned int slot = 0;
+  for (unsigned int a = 0; ok && a < n_arrays; a++) {
+    for (unsigned int i = 0; ok && i < generators[a]->count; i++) {
+      copy_permutation_from_array(&g, generators[a], i);
+      copy_permutation_into(&state[slot++], &g);
+      int extended;
+      ok = sift_and_extend(&chain, &g, &extended);
+    }
+  }
+
+  random_source source;
+  seed_random_source(&source, chain_seed);
+  for (unsigned int i = slot; ok && i < n_slots; i++) {
+    copy_permutation_into(&state[i], &state[i % slot]);
+  }
+  if (ok) {
+    identity_permutation(&state[n_slots]);
+    for (unsigned int i = 0; i < PRODUCT_REPLACEMENT_WARMUP; i++) {
+      next_random_element(state, n_slots, &source);
+    }
+  }
+  for (unsigned int confirmed = 0; ok && confirmed < CHAIN_CONFIRMATIONS;) {
+    next_random_element(state, n_slots, &source);
+    copy_permutation_into(&g, &state[n_slots]);
+    int extended;
+    ok = sift_and_extend(&chain, &g, &extended);
+    confirmed = extended ? 0 : confirmed + 1;
+  }
+
+  ok = ok && pack_chain(out, &chain);
+  for (unsigned int i = 0; i < n_state; i++) {
+    free_permutation(&state[i]);
+  }
+  free(state);
+  free_partial_chain(&chain);
+  return ok;
+}
+
+int stabilizer_chain_contains(const stabilizer_chain* chain,
+                              const permutation* g) {
+  STACK_ALLOC_PERMUTATION(residue, g->domain);
+  copy_permutation_into(&residue, g);
+  for (unsigned int l = 0; l < chain->n_levels; l++) {
+    // Finds the element of the transversal that agrees with the residue on all
+    // base points of the level.
+    unsigned int k = chain->offsets[l];
+    for (; k < chain->offsets[l + 1]; k++) {
+      unsigned int i = chain->first_base[l];
+      while (i < chain->first_base[l + 1] &&
+             PERMUTATION_ARRAY_GET(&chain->transversals, k, chain->base[i]) ==
+                 PERMUTATION_GET(&residue, chain->base[i])) {
+        i++;
+      }
+      if (i == chain->first_base[l + 1]) {
+        break;
+      }
+    }
+    if (k == chain->offsets[l + 1]) {
+      return 0;
+    }
+    multiply_permutation_from_array_inv(&residue, &chain->transversals, k);
+  }
+  return is_identity(&residue);
+}
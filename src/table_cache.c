@@ -0,0 +1,339 @@
+#define _DEFAULT_SOURCE
+
+#include <zkp-volte-patarin-nachef/params.h>
+
+#include <stdio.h>
+
+#include "internals.h"
+
+static char* cache_directory = NULL;
+
+int zkp_set_table_cache_directory(const char* path) {
+  char* copy = NULL;
+  if (path != NULL) {
+    copy = malloc(strlen(path) + 1);
+    if (copy == NULL) {
+      return 0;
+    }
+    strcpy(copy, path);
+  }
+  free(cache_directory);
+  cache_directory = copy;
+  return 1;
+}
+
+#ifndef __WASM__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TABLE_CACHE_MAGIC "ZKPVPNT"
+#define TABLE_CACHE_VERSION 1
+#define TABLE_CACHE_BYTE_ORDER 0x01020304
+#define TABLE_CACHE_MAX_ARRAYS 4
+#define TABLE_CACHE_MAX_NAME 16
+// The header is padded to a multiple of the cache line size, such that all
+// permutations in the file are aligned in memory as well.
+#define TABLE_CACHE_HEADER_SIZE 256
+
+// All integers are stored in native byte order. Files that were written on a
+// machine with a different byte order or a different layout of
+// permutation_array are rejected, not converted.
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t cache_line_size;
+  uint32_t n_arrays;
+  char name[TABLE_CACHE_MAX_NAME];
+  // Checksum of everything that follows the header.
+  uint64_t checksum;
+  struct {
+    uint32_t domain;
+    uint32_t count;
+    uint32_t stride;
+    // The number of slots of the hash index, or zero if there is none.
+    uint32_t n_index_slots;
+  } arrays[TABLE_CACHE_MAX_ARRAYS];
+} table_cache_header;
+
+typedef char table_cache_header_fits[
+    sizeof(table_cache_header) <= TABLE_CACHE_HEADER_SIZE ? 1 : -1];
+
+static size_t rows_size(const permutation_array* array) {
+  return (size_t) array->count * PERMUTATION_ARRAY_STRIDE(array->domain) *
+         PERMUTATION_ELEMENT_SIZE(array->domain);
+}
+
+static size_t padded_index_size(uint32_t n_slots) {
+  const size_t size = (size_t) n_slots * sizeof(uint32_t);
+  return (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+// Computes the checksum of the data, whose size must be a multiple of the cache
+// line size. Four independent lanes keep the multiplier busy.
+static uint64_t checksum(const unsigned char* data, size_t size) {
+  uint64_t h[4] = { 0, 1, 2, 3 };
+  for (size_t i = 0; i < size; i += sizeof(h)) {
+    for (unsigned int lane = 0; lane < 4; lane++) {
+      uint64_t word;
+      memcpy(&word, data + i + lane * sizeof(word), sizeof(word));
+      h[lane] = (h[lane] ^ word) * UINT64_C(0x9e3779b97f4a7c15);
+      h[lane] ^= h[lane] >> 29;
+    }
+  }
+  return ((h[0] * 3 + h[1]) * 3 + h[2]) * 3 + h[3];
+}
+
+// Checks the contents of a mapped array, which the checksum cannot vouch for,
+// since anyone who can write the file can recompute it.
+static int is_valid_mapped_array(const permutation_array* array) {
+  STACK_ALLOC_PERMUTATION(buf, array->domain);
+  for (unsigned int i = 0; i < array->count; i++) {
+    const permutation element = load_permutation_from_array(array, i, &buf);
+    if (!is_permutation(&element)) {
+      return 0;
+    }
+  }
+  if (array->index == NULL) {
+    return 1;
+  }
+  // Lookups stop at the first empty slot, and must not leave the array.
+  int has_empty_slot = 0;
+  for (uint32_t slot = 0; slot <= array->index_mask; slot++) {
+    if (array->index[slot] > array->count) {
+      return 0;
+    }
+    has_empty_slot |= array->index[slot] == 0;
+  }
+  return has_empty_slot;
+}
+
+static int cache_file_path(char* path, size_t size, const char* name,
+                           const char* suffix) {
+  if (cache_directory == NULL || strlen(name) >= TABLE_CACHE_MAX_NAME) {
+    return 0;
+  }
+  int n = snprintf(path, size, "%s/%s.zkptables%s", cache_directory, name,
+                   suffix);
+  return n > 0 && (size_t) n < size;
+}
+
+static void init_header(table_cache_header* header, const char* name,
+                        permutation_array* const* arrays,
+                        unsigned int n_arrays) {
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, TABLE_CACHE_MAGIC, sizeof(header->magic));
+  header->version = TABLE_CACHE_VERSION;
+  header->byte_order = TABLE_CACHE_BYTE_ORDER;
+  header->cache_line_size = CACHE_LINE_SIZE;
+  header->n_arrays = n_arrays;
+  strcpy(header->name, name);
+  for (unsigned int i = 0; i < n_arrays; i++) {
+    header->arrays[i].domain = arrays[i]->domain;
+    header->arrays[i].count = arrays[i]->count;
+    header->arrays[i].stride = PERMUTATION_ARRAY_STRIDE(arrays[i]->domain);
+  }
+}
+
+int map_cached_permutation_arrays(const char* name,
+                                  permutation_array* const* arrays,
+                                  unsigned int n_arrays) {
+  char path[4096];
+  if (n_arrays > TABLE_CACHE_MAX_ARRAYS ||
+      !cache_file_path(path, sizeof(path), name, "")) {
+    return 0;
+  }
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return 0;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t) st.st_size < TABLE_CACHE_HEADER_SIZE) {
+    close(fd);
+    return 0;
+  }
+  const size_t size = (size_t) st.st_size;
+  unsigned char* data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return 0;
+  }
+
+  table_cache_header expected, actual;
+  init_header(&expected, name, arrays, n_arrays);
+  memcpy(&actual, data, sizeof(actual));
+  expected.checksum = actual.checksum;
+  int valid = 1;
+  size_t expected_size = TABLE_CACHE_HEADER_SIZE;
+  for (unsigned int i = 0; i < n_arrays; i++) {
+    // The index is optional, but must be sized like index_permutation_array.
+    const uint32_t n_slots = actual.arrays[i].n_index_slots;
+    expected.arrays[i].n_index_slots = n_slots;
+    valid = valid &&
+            (n_slots == 0 || n_slots == index_slot_count(arrays[i]->count));
+    expected_size += rows_size(arrays[i]);
+    if (n_slots != 0) {
+      expected_size += padded_index_size(n_slots);
+    }
+  }
+  if (!valid || memcmp(&expected, &actual, sizeof(actual)) != 0 ||
+      size != expected_size ||
+      checksum(data + TABLE_CACHE_HEADER_SIZE,
+               size - TABLE_CACHE_HEADER_SIZE) != actual.checksum) {
+    munmap(data, size);
+    return 0;
+  }
+
+#ifdef MADV_HUGEPAGE
+  // Best effort only, since not all file systems support huge pages.
+  madvise(data, size, MADV_HUGEPAGE);
+#endif
+
+  permutation_array mapped[TABLE_CACHE_MAX_ARRAYS];
+  size_t offset = TABLE_CACHE_HEADER_SIZE;
+  for (unsigned int i = 0; valid && i < n_arrays; i++) {
+    mapped[i] = *arrays[i];
+    mapped[i].implicit = NULL;
+    if (PERMUTATION_IS_SMALL(arrays[i])) {
+      mapped[i].base.small = data + offset;
+    } else {
+      mapped[i].base.large = (const uint16_t*) (data + offset);
+    }
+    offset += rows_size(arrays[i]);
+    const uint32_t n_slots = actual.arrays[i].n_index_slots;
+    mapped[i].index = NULL;
+    if (n_slots != 0) {
+      mapped[i].index = (const uint32_t*) (data + offset);
+      mapped[i].index_mask = n_slots - 1;
+      offset += padded_index_size(n_slots);
+    }
+    valid = is_valid_mapped_array(&mapped[i]);
+  }
+  if (!valid) {
+    munmap(data, size);
+    return 0;
+  }
+  for (unsigned int i = 0; i < n_arrays; i++) {
+    *arrays[i] = mapped[i];
+  }
+  return 1;
+}
+
+void unmap_cached_permutation_arrays(permutation_array* const* arrays,
+                                     unsigned int n_arrays) {
+  size_t size = TABLE_CACHE_HEADER_SIZE;
+  for (unsigned int i = 0; i < n_arrays; i++) {
+    size += rows_size(arrays[i]);
+    if (arrays[i]->index != NULL) {
+      size += padded_index_size(arrays[i]->index_mask + 1);
+    }
+  }
+  munmap((unsigned char*) arrays[0]->base.small - TABLE_CACHE_HEADER_SIZE,
+         size);
+}
+
+static int write_all(int fd, const void* data, size_t size) {
+  const unsigned char* bytes = data;
+  while (size != 0) {
+    ssize_t n = write(fd, bytes, size);
+    if (n <= 0) {
+      return 0;
+    }
+    bytes += n;
+    size -= (size_t) n;
+  }
+  return 1;
+}
+
+int write_cached_permutation_arrays(const char* name,
+                                    permutation_array* const* arrays,
+                                    unsigned int n_arrays) {
+  char path[4096], tmp_path[4096];
+  if (n_arrays > TABLE_CACHE_MAX_ARRAYS ||
+      !cache_file_path(path, sizeof(path), name, "") ||
+      !cache_file_path(tmp_path, sizeof(tmp_path), name, ".XXXXXX")) {
+    return 0;
+  }
+
+  table_cache_header header;
+  init_header(&header, name, arrays, n_arrays);
+  size_t size = TABLE_CACHE_HEADER_SIZE;
+  for (unsigned int i = 0; i < n_arrays; i++) {
+    if (arrays[i]->implicit != NULL) {
+      return 0;
+    }
+    size += rows_size(arrays[i]);
+    if (arrays[i]->index != NULL) {
+      header.arrays[i].n_index_slots = arrays[i]->index_mask + 1;
+      size += padded_index_size(header.arrays[i].n_index_slots);
+    }
+  }
+
+  // Concurrent writers each use their own temporary file, and readers only
+  // ever see complete files, which are moved into place atomically.
+  int fd = mkstemp(tmp_path);
+  if (fd < 0) {
+    return 0;
+  }
+  static const unsigned char padding[TABLE_CACHE_HEADER_SIZE];
+  int ok = write_all(fd, padding, TABLE_CACHE_HEADER_SIZE);
+  for (unsigned int i = 0; ok && i < n_arrays; i++) {
+    ok = write_all(fd, arrays[i]->base.small, rows_size(arrays[i]));
+    if (ok && arrays[i]->index != NULL) {
+      const uint32_t n_slots = header.arrays[i].n_index_slots;
+      const size_t index_size = (size_t) n_slots * sizeof(uint32_t);
+      ok = write_all(fd, arrays[i]->index, index_size) &&
+           write_all(fd, padding, padded_index_size(n_slots) - index_size);
+    }
+  }
+
+  // The checksum is computed from the file, exactly as readers do.
+  unsigned char* data =
+      ok ? mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+  if (data != MAP_FAILED) {
+    header.checksum = checksum(data + TABLE_CACHE_HEADER_SIZE,
+                               size - TABLE_CACHE_HEADER_SIZE);
+    munmap(data, size);
+    ok = pwrite(fd, &header, sizeof(header), 0) == sizeof(header);
+  } else {
+    ok = 0;
+  }
+  ok = close(fd) == 0 && ok;
+  ok = ok && chmod(tmp_path, 0644) == 0 && rename(tmp_path, path) == 0;
+  if (!ok) {
+    unlink(tmp_path);
+  }
+  return ok;
+}
+
+#else
+
+int map_cached_permutation_arrays(const char* name,
+                                  permutation_array* const* arrays,
+                                  unsigned int n_arrays) {
+  (void) name;
+  (void) arrays;
+  (void) n_arrays;
+  return 0;
+}
+
+int write_cached_permutation_arrays(const char* name,
+                                    permutation_array* const* arrays,
+                                    unsigned int n_arrays) {
+  (void) name;
+  (void) arrays;
+  (void) n_arrays;
+  return 0;
+}
+
+void unmap_cached_permutation_arrays(permutation_array* const* arrays,
+                                     unsigned int n_arrays) {
+  (void) arrays;
+  (void) n_arrays;
+}
+
+#endif
@@ -1,18 +1,645 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <assert.h>
 #include <math.h>
+#include <pthread.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <zkp-volte-patarin-nachef/params.h>
 #include <zkp-volte-patarin-nachef/protocol.h>
 
+#include "../src/internals.h"
+
 #include "vectors_3x3x3.h"
 #include "vectors_5x5x5.h"
+#include "vectors_commitment.h"
 #include "vectors_s41.h"
 #include "vectors_s41ast.h"
 #include "vectors_s43ast.h"
 #include "vectors_s53ast.h"
 
+#define DEFINE_RANDOM_PERMUTATION(name, type)                                  \
+  static void name(type* perm, unsigned int n, uint32_t* state) {              \
+    for (unsigned int i = 0; i < n; i++) {                                     \
+      perm[i] = (type) (i + 1);                                                \
+    }                                                                          \
+    for (unsigned int i = n; i > 1; i--) {                                     \
+      *state = *state * 1103515245 + 12345;                                    \
+      unsigned int j = (*state >> 16) % i;                                     \
+      type t = perm[i - 1];                                                    \
+      perm[i - 1] = perm[j];                                                   \
+      perm[j] = t;                                                             \
+    }                                                                          \
+  }
+
+DEFINE_RANDOM_PERMUTATION(random_small_permutation, uint8_t)
+DEFINE_RANDOM_PERMUTATION(random_large_permutation, uint16_t)
+
+static void test_random(void) {
+  // RFC 8439, Section 2.3.2.
+  unsigned char key[CHACHA20_KEY_SIZE];
+  for (unsigned int i = 0; i < CHACHA20_KEY_SIZE; i++) {
+    key[i] = (unsigned char) i;
+  }
+  const unsigned char nonce[CHACHA20_NONCE_SIZE] = { 0, 0, 0, 0x09, 0, 0,
+                                                     0, 0x4a, 0, 0, 0, 0 };
+  const unsigned char expected[CHACHA20_BLOCK_SIZE] = {
+    0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd,
+    0x1f, 0xa3, 0x20, 0x71, 0xc4, 0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0,
+    0x68, 0x03, 0x04, 0x22, 0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e, 0xd2,
+    0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa, 0x09, 0x14, 0xc2, 0xd7, 0x05,
+    0xd9, 0x8b, 0x02, 0xa2, 0xb5, 0x12, 0x9c, 0xd1, 0xde, 0x16, 0x4e,
+    0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e
+  };
+  unsigned char block[CHACHA20_BLOCK_SIZE];
+  chacha20_block(key, 1, nonce, block);
+  assert(memcmp(block, expected, sizeof(block)) == 0);
+
+  // Requests that span multiple batches of the keystream.
+  unsigned char a[3000], b[3000];
+  memset_random(a, sizeof(a));
+  memset_random(b, sizeof(b));
+  assert(memcmp(a, b, sizeof(a)) != 0);
+
+  // A child process must not continue the keystream of its parent.
+  int fds[2];
+  int ret = pipe(fds);
+  assert(ret == 0);
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    memset_random(a, 32);
+    _exit(write(fds[1], a, 32) == 32 ? 0 : 1);
+  }
+  memset_random(b, 32);
+  const ssize_t n_read = read(fds[0], a, 32);
+  assert(n_read == 32);
+  int status;
+  const pid_t reaped = waitpid(pid, &status, 0);
+  assert(reaped == pid);
+  assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  assert(memcmp(a, b, 32) != 0);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+static void test_random_permutations(void) {
+  // All six permutations of three points must be about equally likely.
+  const unsigned int count = 6000;
+  uint8_t small[count][4];
+  random_permutations_small(NULL, small[0], 4, 3, count);
+  unsigned int histogram[27] = { 0 };
+  for (unsigned int k = 0; k < count; k++) {
+    permutation p = { .domain = 3, .mapping.small = small[k] };
+    assert(is_permutation(&p));
+    const uint8_t* m = small[k];
+    histogram[(m[0] - 1) * 9 + (m[1] - 1) * 3 + m[2] - 1]++;
+  }
+  unsigned int n_seen = 0;
+  for (unsigned int i = 0; i < 27; i++) {
+    if (histogram[i] != 0) {
+      assert(histogram[i] > 800 && histogram[i] < 1200);
+      n_seen++;
+    }
+  }
+  assert(n_seen == 6);
+
+  uint16_t large[4][320];
+  random_permutations_large(NULL, large[0], 320, 300, 4);
+  for (unsigned int k = 0; k < 4; k++) {
+    permutation p = { .domain = 300, .mapping.large = large[k] };
+    assert(is_permutation(&p));
+  }
+}
+
+static void test_shuffle_kernels(void) {
+  const shuffle_kernels* ref = NULL;
+  for (unsigned int i = 0; all_shuffle_kernels[i] != NULL; i++) {
+    ref = all_shuffle_kernels[i];
+  }
+  assert(ref->is_supported());
+
+  uint32_t state = 1;
+  for (unsigned int i = 0; all_shuffle_kernels[i] != NULL; i++) {
+    const shuffle_kernels* impl = all_shuffle_kernels[i];
+    if (!impl->is_supported()) {
+      continue;
+    }
+
+    for (unsigned int n = 1; n <= MAX_DOMAIN_SMALL_REPR; n++) {
+      uint8_t a[n], b[n], t[n], expected[n], actual[n];
+      random_small_permutation(a, n, &state);
+      random_small_permutation(b, n, &state);
+
+      ref->compose(expected, a, b, n);
+      impl->compose(actual, a, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+      memcpy(actual, a, n);
+      impl->compose(actual, actual, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+
+      ref->inverse(expected, a, n);
+      impl->inverse(actual, a, n);
+      assert(memcmp(expected, actual, n) == 0);
+
+      ref->inverse(t, b, n);
+      ref->compose(expected, a, t, n);
+      impl->compose_inverse(actual, a, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+      memcpy(actual, a, n);
+      impl->compose_inverse(actual, actual, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+
+      ref->inverse(t, a, n);
+      ref->compose(expected, t, b, n);
+      impl->inverse_compose(actual, a, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+
+      ref->inverse(t, b, n);
+      ref->compose(t, t, a, n);
+      ref->compose(expected, t, b, n);
+      impl->conjugate(actual, a, b, n);
+      assert(memcmp(expected, actual, n) == 0);
+    }
+  }
+}
+
+static void test_gather_kernels(void) {
+  const gather_kernels* ref = NULL;
+  for (unsigned int i = 0; all_gather_kernels[i] != NULL; i++) {
+    ref = all_gather_kernels[i];
+  }
+  assert(ref->is_supported());
+
+  const unsigned int domains[] = { 256, 257, 288, 300, 511, 512, 513, 1000,
+                                   1024 };
+
+  uint32_t state = 1;
+  for (unsigned int i = 0; all_gather_kernels[i] != NULL; i++) {
+    const gather_kernels* impl = all_gather_kernels[i];
+    if (!impl->is_supported()) {
+      continue;
+    }
+
+    for (unsigned int k = 0; k < sizeof(domains) / sizeof(domains[0]); k++) {
+      const unsigned int n = domains[k];
+      uint16_t a[n], b[n], t[n], expected[n], actual[n];
+      random_large_permutation(a, n, &state);
+      random_large_permutation(b, n, &state);
+
+      ref->compose(expected, a, b, n);
+      impl->compose(actual, a, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+      memcpy(actual, a, sizeof(actual));
+      impl->compose(actual, actual, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+
+      ref->inverse(expected, a, n);
+      impl->inverse(actual, a, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+
+      ref->inverse(t, b, n);
+      ref->compose(expected, a, t, n);
+      impl->compose_inverse(actual, a, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+      memcpy(actual, a, sizeof(actual));
+      impl->compose_inverse(actual, actual, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+
+      ref->inverse(t, a, n);
+      ref->compose(expected, t, b, n);
+      impl->inverse_compose(actual, a, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+
+      ref->inverse(t, b, n);
+      ref->compose(t, t, a, n);
+      ref->compose(expected, t, b, n);
+      impl->conjugate(actual, a, b, n);
+      assert(memcmp(expected, actual, sizeof(actual)) == 0);
+    }
+  }
+}
+
+static int permutations_equal(const permutation* a, const permutation* b) {
+  for (unsigned int i = 0; i < a->domain; i++) {
+    if (PERMUTATION_GET(a, i) != PERMUTATION_GET(b, i)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void test_sha256_kernels(void) {
+  // The sizes cover messages whose padding fits into the last block or not, as
+  // well as the representations of all parameter sets.
+  static const size_t sizes[] = { 0, 1, 41, 48, 55, 56, 63, 64, 106, 119, 576 };
+  enum { max_messages = 2 * MAX_SHA256_LANES + 3, max_size = 576 };
+  static unsigned char keys[max_messages][COMMITMENT_SIZE];
+  static unsigned char messages[max_messages][max_size];
+  const unsigned char* key_ptrs[max_messages];
+  const unsigned char* message_ptrs[max_messages];
+  memset_random(keys, sizeof(keys));
+  memset_random(messages, sizeof(messages));
+  for (unsigned int i = 0; i < max_messages; i++) {
+    key_ptrs[i] = keys[i];
+    message_ptrs[i] = messages[i];
+  }
+
+  // The known answers commit to the message whose byte j is 7 j + 3 mod 256
+  // with the key 0, 1, ..., 31, which OpenSSL confirms.
+  static const unsigned char
+      known_answers[2][sizeof(sizes) / sizeof(sizes[0])][COMMITMENT_SIZE] = {
+        { TEST_COMMITMENT_HMAC_SHA256 },
+        { TEST_COMMITMENT_SHA256 },
+      };
+  unsigned char known_key[COMMITMENT_SIZE];
+  static unsigned char known_message[max_size];
+  for (unsigned int i = 0; i < COMMITMENT_SIZE; i++) {
+    known_key[i] = i;
+  }
+  for (unsigned int j = 0; j < max_size; j++) {
+    known_message[j] = (unsigned char) (7 * j + 3);
+  }
+  const unsigned char* known_key_ptr = known_key;
+  const unsigned char* known_message_ptr = known_message;
+
+  // The last kernels are the portable reference.
+  const sha256_kernels* reference = all_sha256_kernels[0];
+  for (unsigned int k = 1; all_sha256_kernels[k] != NULL; k++) {
+    reference = all_sha256_kernels[k];
+  }
+
+  const commitment_scheme* schemes[] = { &commitment_hmac_sha256,
+                                         &commitment_sha256 };
+  unsigned char expected[max_messages][COMMITMENT_SIZE];
+  unsigned char actual[max_messages][COMMITMENT_SIZE];
+  // The engine is reused for all sizes and kernels of a scheme.
+  static commitment_engine engine;
+  for (unsigned int c = 0; c < sizeof(schemes) / sizeof(schemes[0]); c++) {
+    init_commitment_engine(&engine, schemes[c]);
+    for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+      commit_with_kernels(&engine, reference, &known_key_ptr,
+                          &known_message_ptr, sizes[s], 1, actual[0]);
+      assert(memcmp(known_answers[c][s], actual[0], COMMITMENT_SIZE) == 0);
+      // The other kernels must agree with the portable one.
+      commit_with_kernels(&engine, reference, key_ptrs, message_ptrs, sizes[s],
+                          max_messages, expected[0]);
+      for (unsigned int n = 1; n <= max_messages; n++) {
+        for (unsigned int k = 0; all_sha256_kernels[k] != NULL; k++) {
+          if (!all_sha256_kernels[k]->is_supported()) {
+            continue;
+          }
+          memset(actual, 0, sizeof(actual));
+          commit_with_kernels(&engine, all_sha256_kernels[k], key_ptrs,
+                              message_ptrs, sizes[s], n, actual[0]);
+          assert(memcmp(expected, actual, n * COMMITMENT_SIZE) == 0);
+        }
+        commit_batch(&engine, key_ptrs, message_ptrs, sizes[s], n,
+                     actual[0]);
+        assert(memcmp(expected, actual, n * COMMITMENT_SIZE) == 0);
+      }
+    }
+  }
+}
+
+static void test_permutation_engine(const zkp_params* params) {
+  const permutation_engine* engines[] = { params->engine,
+                                          &generic_permutation_engine };
+  permutation sigma, x, tau, expected, actual;
+  int ok = alloc_permutation(&sigma, params->domain) &&
+           alloc_permutation(&x, params->domain) &&
+           alloc_permutation(&tau, params->domain) &&
+           alloc_permutation(&expected, params->domain) &&
+           alloc_permutation(&actual, params->domain);
+  assert(ok);
+  (void) ok;
+
+  for (unsigned int iter = 0; iter < 16; iter++) {
+    const unsigned int f_index = rand_less_than(params->F.count);
+    const unsigned int tau_index = rand_less_than(params->H.count);
+    params->G_.random_element(&sigma, params, NULL);
+    params->G_.random_element(&x, params, NULL);
+    copy_permutation_from_array(&tau, &params->H, tau_index);
+
+    for (unsigned int e = 0; e < sizeof(engines) / sizeof(engines[0]); e++) {
+      copy_permutation_from_array(&x, &params->F, f_index);
+      conjugate_permutation(&expected, &x, &tau);
+      engines[e]->conjugate(&actual, &params->F, f_index, &tau);
+      assert(permutations_equal(&expected, &actual));
+
+      compose_permutations(&expected, &tau, &x);
+      multiply_permutation(&expected, &sigma);
+      engines[e]->compose3(&actual, &tau, &x, &sigma);
+      assert(permutations_equal(&expected, &actual));
+
+      conjugate_permutation(&expected, &sigma, &tau);
+      multiply_permutation(&expected, &x);
+      engines[e]->conjugate_compose(&actual, &sigma, &tau, &x);
+      assert(permutations_equal(&expected, &actual));
+
+      copy_permutation_from_array(&expected, &params->F, f_index);
+      multiply_permutation(&expected, &sigma);
+      engines[e]->compose(&actual, &params->F, f_index, &sigma);
+      assert(permutations_equal(&expected, &actual));
+    }
+  }
+
+  free_permutation(&sigma);
+  free_permutation(&x);
+  free_permutation(&tau);
+  free_permutation(&expected);
+  free_permutation(&actual);
+}
+
+static void test_index_of_permutation(const zkp_params* params) {
+  STACK_ALLOC_PERMUTATION(p, params->domain);
+  STACK_ALLOC_PERMUTATION(q, params->domain);
+  unsigned int index;
+
+  // Looking up elements of implicit arrays takes linear time, so only do that
+  // if the parameters do not need to.
+  const int lookup = !params->cyclic || params->F.implicit == NULL;
+  if (lookup) {
+    for (unsigned int i = 0; i < params->F.count; i++) {
+      copy_permutation_from_array(&p, &params->F, i);
+      assert(index_of_permutation_in_array(&p, &params->F, &index));
+      assert(index == i);
+    }
+
+    identity_permutation(&p);
+    assert(!index_of_permutation_in_array(&p, &params->F, &index));
+  }
+
+  // Each conjugate of an element of F by an element of H is in F, and the
+  // precomputed table, if any, must agree with the lookup.
+  for (unsigned int iter = 0; iter < 256; iter++) {
+    const unsigned int f_index = rand_less_than(params->F.count);
+    const unsigned int tau_index = rand_less_than(params->H.count);
+    conjugate_array_element(&p, &params->F, f_index, &params->H, tau_index);
+    if (lookup) {
+      assert(index_of_permutation_in_array(&p, &params->F, &index));
+    }
+    if (params->conjugates != NULL) {
+      assert(params->conjugates[tau_index * params->F.count + f_index] ==
+             index);
+    }
+    if (params->cyclic) {
+      index = (f_index + tau_index) % params->F.count;
+      copy_permutation_from_array(&q, &params->F, index);
+      assert(permutations_equal(&p, &q));
+      copy_permutation_from_array(
+          &q, &params->H, (params->H.count - tau_index) % params->H.count);
+      compose_permutation_with_array(&p, &q, &params->H, tau_index);
+      for (unsigned int i = 0; i < params->domain; i++) {
+        assert(PERMUTATION_GET(&p, i) == i);
+      }
+    }
+  }
+}
+
+static void test_h_reprs(const zkp_params* params) {
+  if (params->h_reprs == NULL) {
+    return;
+  }
+  const unsigned char* repr = params->h_reprs;
+  for (unsigned int i = 0; i < params->H.count; i++) {
+    const permutation h = permutation_array_element(&params->H, i);
+    for (unsigned int j = 0; j < params->domain; j++) {
+      assert((unsigned int) (repr[0] + repr[1] * MAX_DOMAIN_SMALL_REPR) ==
+             PERMUTATION_GET(&h, j) + 1);
+      repr += 2;
+    }
+  }
+}
+
+// The order of the group generated by F and H of the 3x3x3 parameter set is
+// twice that of the Rubik's Cube group, 2^27 * 3^14 * 5^3 * 7^2 * 11, since H
+// is not contained in the latter.
+static const unsigned int order_3x3x3_primes[] = { 2, 3, 5, 7, 11 };
+static const unsigned int order_3x3x3_exponents[] = { 28, 14, 3, 2, 1 };
+
+static void test_stabilizer_chain(const zkp_params* params,
+                                  const unsigned int* order_exponents) {
+  const stabilizer_chain* chain = params->G_.chain;
+  assert(chain->n_levels != 0 && chain->offsets[0] == 0 &&
+         chain->offsets[chain->n_levels] == chain->transversals.count);
+
+  unsigned int exponents[5] = { 0 };
+  for (unsigned int l = 0; l < chain->n_levels; l++) {
+    // Each element of the transversal of a level fixes the base points of all
+    // previous levels, and the elements map the base points of the level
+    // differently.
+    for (unsigned int k = chain->offsets[l]; k < chain->offsets[l + 1]; k++) {
+      for (unsigned int i = 0; i < chain->first_base[l]; i++) {
+        const unsigned int b = chain->base[i];
+        assert(PERMUTATION_ARRAY_GET(&chain->transversals, k, b) == b);
+      }
+      for (unsigned int j = chain->offsets[l]; j < k; j++) {
+        unsigned int i = chain->first_base[l];
+        while (i < chain->first_base[l + 1] &&
+               PERMUTATION_ARRAY_GET(&chain->transversals, k, chain->base[i]) ==
+                   PERMUTATION_ARRAY_GET(&chain->transversals, j,
+                                         chain->base[i])) {
+          i++;
+        }
+        assert(i != chain->first_base[l + 1]);
+      }
+    }
+
+    unsigned int size = chain->offsets[l + 1] - chain->offsets[l];
+    for (unsigned int p = 0; p < 5; p++) {
+      for (; size % order_3x3x3_primes[p] == 0; size /= order_3x3x3_primes[p]) {
+        exponents[p]++;
+      }
+    }
+    assert(order_exponents == NULL || size == 1);
+  }
+  if (order_exponents != NULL) {
+    assert(memcmp(exponents, order_exponents, sizeof(exponents)) == 0);
+  }
+
+  permutation g;
+  int ok = alloc_permutation(&g, params->domain);
+  assert(ok);
+  (void) ok;
+  for (unsigned int i = 0; i < params->F.count; i++) {
+    copy_permutation_from_array(&g, &params->F, i);
+    assert(stabilizer_chain_contains(chain, &g));
+  }
+  for (unsigned int i = 0; i < params->H.count; i++) {
+    copy_permutation_from_array(&g, &params->H, i);
+    assert(stabilizer_chain_contains(chain, &g));
+  }
+  for (unsigned int i = 0; i < 64; i++) {
+    params->G_.random_element(&g, params, NULL);
+    assert(is_permutation(&g));
+    assert(stabilizer_chain_contains(chain, &g));
+  }
+
+  // Random elements are drawn from the chain itself, so they cannot reveal a
+  // chain that describes a subgroup only. Long random words in the generators
+  // can, which matters where the group order is not known.
+  const unsigned int n_generators = params->F.count + params->H.count;
+  for (unsigned int i = 0; i < 16; i++) {
+    identity_permutation(&g);
+    for (unsigned int j = 0; j < 256; j++) {
+      const unsigned int k = rand_less_than(n_generators);
+      if (k < params->F.count) {
+        multiply_permutation_from_array(&g, &params->F, k);
+      } else {
+        multiply_permutation_from_array(&g, &params->H, k - params->F.count);
+      }
+    }
+    assert(stabilizer_chain_contains(chain, &g));
+  }
+
+  // Transpositions of two facelets are not moves of the cube.
+  identity_permutation(&g);
+  PERMUTATION_SET(&g, 0, 1);
+  PERMUTATION_SET(&g, 1, 0);
+  assert(!stabilizer_chain_contains(chain, &g));
+
+  free_permutation(&g);
+}
+
+// Writes the arrays to the table cache file "test" and returns whether they can
+// be mapped again.
+static int remap_cached_arrays(permutation_array* h, permutation_array* f) {
+  permutation_array* const arrays[] = { h, f };
+  int ok = write_cached_permutation_arrays("test", arrays, 2);
+  assert(ok);
+  permutation_array mapped_h = { .domain = h->domain, .count = h->count };
+  permutation_array mapped_f = { .domain = f->domain, .count = f->count };
+  permutation_array* const mapped[] = { &mapped_h, &mapped_f };
+  if (!map_cached_permutation_arrays("test", mapped, 2)) {
+    return 0;
+  }
+  unmap_cached_permutation_arrays(mapped, 2);
+  return 1;
+}
+
+static void test_table_cache(const zkp_params* params) {
+  if (params->F.implicit != NULL) {
+    return;
+  }
+
+  char dir[] = "/tmp/zkp-test-XXXXXX";
+  const char* created = mkdtemp(dir);
+  assert(created != NULL);
+  (void) created;
+  int ok = zkp_set_table_cache_directory(dir);
+  assert(ok);
+
+  permutation_array h = params->H, f = params->F;
+  permutation_array* const arrays[] = { &h, &f };
+  ok = write_cached_permutation_arrays("test", arrays, 2);
+  assert(ok);
+
+  permutation_array mapped_h = { .domain = h.domain, .count = h.count };
+  permutation_array mapped_f = { .domain = f.domain, .count = f.count };
+  permutation_array* const mapped[] = { &mapped_h, &mapped_f };
+  ok = map_cached_permutation_arrays("test", mapped, 2);
+  assert(ok);
+  for (unsigned int i = 0; i < h.count; i++) {
+    const permutation expected = permutation_array_element(&h, i);
+    const permutation actual = permutation_array_element(&mapped_h, i);
+    assert(permutations_equal(&expected, &actual));
+  }
+  for (unsigned int i = 0; i < f.count; i++) {
+    const permutation expected = permutation_array_element(&f, i);
+    const permutation actual = permutation_array_element(&mapped_f, i);
+    assert(permutations_equal(&expected, &actual));
+  }
+  assert(mapped_h.index == NULL);
+  assert(mapped_f.index_mask == f.index_mask);
+  assert(memcmp(mapped_f.index, f.index,
+                (f.index_mask + 1) * sizeof(uint32_t)) == 0);
+  unmap_cached_permutation_arrays(mapped, 2);
+
+  // Files must not be mapped for arrays of different sizes.
+  permutation_array other = { .domain = f.domain, .count = f.count - 1 };
+  permutation_array* const others[] = { &mapped_h, &other };
+  ok = map_cached_permutation_arrays("test", others, 2);
+  assert(!ok);
+  ok = map_cached_permutation_arrays("other", mapped, 2);
+  assert(!ok);
+
+  // Neither must corrupted files.
+  char path[sizeof(dir) + 32];
+  snprintf(path, sizeof(path), "%s/test.zkptables", dir);
+  FILE* file = fopen(path, "r+b");
+  assert(file != NULL);
+  int ret = fseek(file, -1, SEEK_END);
+  assert(ret == 0);
+  int c = fgetc(file);
+  assert(c != EOF);
+  ret = fseek(file, -1, SEEK_END);
+  assert(ret == 0);
+  ret = fputc(c ^ 1, file);
+  assert(ret != EOF);
+  ret = fclose(file);
+  assert(ret == 0);
+  other.count = f.count;
+  ok = map_cached_permutation_arrays("test", others, 2);
+  assert(!ok);
+
+  // Files with valid checksums must still be rejected if an index would make
+  // lookups read out of bounds or never terminate, or if a row is not a
+  // permutation.
+  const uint32_t n_slots = f.index_mask + 1;
+  uint32_t* bad_index = calloc(2 * n_slots, sizeof(uint32_t));
+  assert(bad_index != NULL);
+  permutation_array bad_f = f;
+  bad_f.index = bad_index;
+  memcpy(bad_index, f.index, n_slots * sizeof(uint32_t));
+  ok = remap_cached_arrays(&h, &bad_f);
+  assert(ok);
+  unsigned int used_slot = 0;
+  while (bad_index[used_slot] == 0) {
+    used_slot++;
+  }
+  bad_index[used_slot] = f.count + 1;
+  ok = remap_cached_arrays(&h, &bad_f);
+  assert(!ok);
+  for (uint32_t slot = 0; slot < n_slots; slot++) {
+    bad_index[slot] = 1;
+  }
+  ok = remap_cached_arrays(&h, &bad_f);
+  assert(!ok);
+  memset(bad_index, 0, 2 * n_slots * sizeof(uint32_t));
+  bad_f.index_mask = 2 * n_slots - 1;
+  ok = remap_cached_arrays(&h, &bad_f);
+  assert(!ok);
+  free(bad_index);
+
+  const size_t rows_size = (size_t) h.count *
+                           PERMUTATION_ARRAY_STRIDE(h.domain) *
+                           PERMUTATION_ELEMENT_SIZE(h.domain);
+  const size_t element_size = PERMUTATION_ELEMENT_SIZE(h.domain);
+  uint8_t* bad_rows = malloc(rows_size);
+  assert(bad_rows != NULL);
+  memcpy(bad_rows, h.base.small, rows_size);
+  permutation_array bad_h = h;
+  bad_h.base.small = bad_rows;
+  memcpy(bad_rows + element_size, bad_rows, element_size);
+  ok = remap_cached_arrays(&bad_h, &f);
+  assert(!ok);
+  free(bad_rows);
+
+  ret = remove(path);
+  assert(ret == 0);
+  ret = rmdir(dir);
+  assert(ret == 0);
+  ok = zkp_set_table_cache_directory(NULL);
+  assert(ok);
+  (void) ok;
+  (void) ret;
+}
+
 static void test_params(const zkp_params* params, unsigned int n_rounds) {
   const zkp_private_key* private_key = zkp_generate_private_key(params);
   assert(private_key);
@@ -24,11 +651,24 @@ static void test_params(const zkp_params* params, unsigned int n_rounds) {
 
   zkp_proof* proof = zkp_new_proof(private_key);
   assert(proof);
+  // The private key is expanded if and only if H is small.
+  assert((proof->conjugates != NULL) == (params->conjugates != NULL));
+  assert((proof->prefix != NULL) == (params->conjugates == NULL));
 
   zkp_verification* verification = zkp_new_verification(public_key);
   assert(verification);
 
   for (unsigned int round = 1; round <= n_rounds; round++) {
+    // Verify half of the rounds with a prepared public key.
+    if (round == n_rounds / 2) {
+      // Preparing a key again has no effect.
+      int prepared = zkp_prepare_public_key(public_key);
+      assert(prepared);
+      prepared = zkp_prepare_public_key(public_key);
+      assert(prepared);
+      assert((public_key->x0_conjugates_storage != NULL) ==
+             (params->conjugates != NULL));
+    }
     assert(zkp_get_impersonation_probability(verification) > pow(2, -30));
     const unsigned char* commitments = zkp_begin_round(proof);
     unsigned int q = zkp_choose_question(verification);
@@ -93,6 +733,306 @@ static void test_import_export(const zkp_params* params) {
 
   zkp_free_public_key(public_key);
   zkp_free_private_key(private_key);
+
+  // Keys that do not encode a permutation must be rejected, that is, keys with
+  // labels that repeat, are zero, or exceed the domain.
+  const unsigned int label_size = size / params->domain;
+  unsigned char invalid[size];
+  memcpy(invalid, exported_public_key, size);
+  memcpy(invalid + size - label_size, invalid, label_size);
+  assert(zkp_import_public_key(params, invalid) == NULL);
+  memcpy(invalid, exported_public_key, size);
+  memset(invalid + size - label_size, 0, label_size);
+  assert(zkp_import_public_key(params, invalid) == NULL);
+  const unsigned int out_of_range = params->domain + 1;
+  memcpy(invalid, exported_public_key, size);
+  invalid[size - label_size] = (unsigned char) (out_of_range % 255);
+  if (label_size > 1) {
+    invalid[size - 1] = (unsigned char) (out_of_range / 255);
+  }
+  assert(zkp_import_public_key(params, invalid) == NULL);
+}
+
+static void test_insecure_seed(const zkp_params* params) {
+  unsigned char seed[ZKP_INSECURE_SEED_SIZE] = { 1, 2, 3 };
+  const zkp_private_key* keys[2];
+  zkp_proof* proofs[2];
+  zkp_verification* verifications[2];
+  const zkp_public_key* public_key = NULL;
+  for (unsigned int i = 0; i < 2; i++) {
+    keys[i] = zkp_insecure_generate_private_key(params, seed);
+    assert(keys[i]);
+    if (public_key == NULL) {
+      public_key = zkp_compute_public_key(keys[i]);
+      assert(public_key);
+    }
+    proofs[i] = zkp_new_proof(keys[i]);
+    assert(proofs[i]);
+    int seeded = zkp_insecure_seed_proof(proofs[i], seed);
+    assert(seeded);
+    verifications[i] = zkp_new_verification(public_key);
+    assert(verifications[i]);
+    seeded = zkp_insecure_seed_verification(verifications[i], seed);
+    assert(seeded);
+  }
+  assert(memcmp(keys[0]->i, keys[1]->i, params->d * sizeof(unsigned int)) ==
+         0);
+
+  // Both runs must be identical, such that the exported answers of one can be
+  // verified by the other.
+  const unsigned int commitments_size = zkp_get_commitments_size(params);
+  unsigned char exported[2][zkp_get_max_answer_size(params)];
+  for (unsigned int round = 0; round < 8; round++) {
+    const unsigned char* commitments[2];
+    unsigned int q[2];
+    for (unsigned int i = 0; i < 2; i++) {
+      commitments[i] = zkp_begin_round(proofs[i]);
+      q[i] = zkp_choose_question(verifications[i]);
+      zkp_export_answer(params, zkp_get_answer(proofs[i], q[i]), exported[i]);
+    }
+    assert(memcmp(commitments[0], commitments[1], commitments_size) == 0);
+    assert(q[0] == q[1]);
+    const unsigned int answer_size = zkp_get_answer_size(params, q[0]);
+    assert(memcmp(exported[0], exported[1], answer_size) == 0);
+    int ok = zkp_import_verify(verifications[0], commitments[1], exported[1],
+                               answer_size);
+    assert(ok);
+    ok = zkp_verify(verifications[1], commitments[0],
+                    &proofs[0]->round.answer);
+    assert(ok);
+  }
+
+  // Reseeding restarts the run, and other seeds lead to other runs.
+  unsigned char first[commitments_size];
+  int seeded = zkp_insecure_seed_proof(proofs[0], seed);
+  assert(seeded);
+  memcpy(first, zkp_begin_round(proofs[0]), commitments_size);
+  seeded = zkp_insecure_seed_proof(proofs[0], seed);
+  assert(seeded);
+  const unsigned char* again = zkp_begin_round(proofs[0]);
+  assert(memcmp(first, again, commitments_size) == 0);
+  seed[0] ^= 1;
+  seeded = zkp_insecure_seed_proof(proofs[0], seed);
+  assert(seeded);
+  const unsigned char* other = zkp_begin_round(proofs[0]);
+  assert(memcmp(first, other, commitments_size) != 0);
+
+  for (unsigned int i = 0; i < 2; i++) {
+    zkp_free_verification(verifications[i]);
+    zkp_free_proof(proofs[i]);
+    zkp_free_private_key(keys[i]);
+  }
+  zkp_free_public_key(public_key);
+}
+
+typedef struct {
+  zkp_public_key_cache* cache;
+  const zkp_private_key* const* private_keys;
+  const unsigned char* key_material;
+  unsigned int n_keys;
+} cache_test_job;
+
+static void run_cached_round(zkp_public_key_cache* cache,
+                             const zkp_private_key* private_key,
+                             const unsigned char* key_material) {
+  zkp_verification* verification =
+      zkp_new_cached_verification(cache, key_material);
+  assert(verification);
+  zkp_proof* proof = zkp_new_proof(private_key);
+  assert(proof);
+  const unsigned char* commitments = zkp_begin_round(proof);
+  unsigned int q = zkp_choose_question(verification);
+  zkp_answer* answer = zkp_get_answer(proof, q);
+  int ok = zkp_verify(verification, commitments, answer);
+  assert(ok);
+  zkp_free_proof(proof);
+  zkp_free_verification(verification);
+}
+
+static void* run_cached_rounds(void* arg) {
+  const cache_test_job* job = arg;
+  const unsigned int size =
+      zkp_get_public_key_size(job->private_keys[0]->params);
+  for (unsigned int i = 0; i < 64; i++) {
+    const unsigned int k = (i * 7 + 3) % job->n_keys;
+    run_cached_round(job->cache, job->private_keys[k],
+                     job->key_material + k * size);
+  }
+  return NULL;
+}
+
+// Looks up the first key over and over, while other threads evict it.
+static void* look_up_first_key(void* arg) {
+  const cache_test_job* job = arg;
+  for (unsigned int i = 0; i < 256; i++) {
+    zkp_verification* verification =
+        zkp_new_cached_verification(job->cache, job->key_material);
+    assert(verification);
+    zkp_free_verification(verification);
+  }
+  return NULL;
+}
+
+static void test_commitment_schemes(const zkp_params* params) {
+  const zkp_private_key* private_key = zkp_generate_private_key(params);
+  assert(private_key);
+  const zkp_public_key* public_key = zkp_compute_public_key(private_key);
+  assert(public_key);
+  zkp_proof* proof = zkp_new_proof(private_key);
+  assert(proof);
+  zkp_verification* verification = zkp_new_verification(public_key);
+  assert(verification);
+
+  int set = zkp_set_proof_commitment_scheme(proof, (zkp_commitment_scheme) 2);
+  assert(!set);
+  set = zkp_set_verification_commitment_scheme(verification,
+                                               (zkp_commitment_scheme) 2);
+  assert(!set);
+  set = zkp_set_proof_commitment_scheme(proof, ZKP_COMMITMENT_SHA256);
+  assert(set);
+  set = zkp_set_verification_commitment_scheme(verification,
+                                               ZKP_COMMITMENT_SHA256);
+  assert(set);
+  for (unsigned int round = 0; round < 32; round++) {
+    const unsigned char* commitments = zkp_begin_round(proof);
+    unsigned int q = zkp_choose_question(verification);
+    int ok = zkp_verify(verification, commitments, zkp_get_answer(proof, q));
+    assert(ok);
+  }
+
+  // Commitments of one scheme are rejected by the other.
+  for (unsigned int round = 0; round < 32; round++) {
+    set = zkp_set_verification_commitment_scheme(
+        verification,
+        round % 2 ? ZKP_COMMITMENT_SHA256 : ZKP_COMMITMENT_HMAC_SHA256);
+    assert(set);
+    set = zkp_set_proof_commitment_scheme(
+        proof, round % 2 ? ZKP_COMMITMENT_HMAC_SHA256 : ZKP_COMMITMENT_SHA256);
+    assert(set);
+    const unsigned char* commitments = zkp_begin_round(proof);
+    unsigned int q = zkp_choose_question(verification);
+    int ok = zkp_verify(verification, commitments, zkp_get_answer(proof, q));
+    assert(!ok);
+  }
+
+  zkp_free_verification(verification);
+  zkp_free_proof(proof);
+  zkp_free_public_key(public_key);
+  zkp_free_private_key(private_key);
+}
+
+static void test_public_key_cache(const zkp_params* params) {
+  const unsigned int n_keys = 6;
+  const unsigned int size = zkp_get_public_key_size(params);
+  const zkp_private_key* private_keys[n_keys];
+  unsigned char key_material[n_keys * size];
+  for (unsigned int k = 0; k < n_keys; k++) {
+    private_keys[k] = zkp_generate_private_key(params);
+    assert(private_keys[k]);
+    const zkp_public_key* public_key = zkp_compute_public_key(private_keys[k]);
+    assert(public_key);
+    zkp_export_public_key(public_key, key_material + k * size);
+    zkp_free_public_key(public_key);
+  }
+
+  // Determine the memory used by a single key, and allow for four keys.
+  zkp_public_key_cache_stats stats;
+  assert(zkp_new_public_key_cache(params, 0) == NULL);
+  zkp_public_key_cache* cache = zkp_new_public_key_cache(params, 1 << 30);
+  assert(cache);
+  run_cached_round(cache, private_keys[0], key_material);
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.n_keys == 1 && stats.misses == 1 && stats.hits == 0);
+  const size_t budget = 4 * stats.memory_used;
+  zkp_free_public_key_cache(cache);
+  cache = zkp_new_public_key_cache(params, budget);
+  assert(cache);
+
+  for (unsigned int k = 0; k < 4; k++) {
+    run_cached_round(cache, private_keys[k], key_material + k * size);
+  }
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.n_keys == 4 && stats.misses == 4 && stats.hits == 0);
+
+  // Freed verifications are reused, with the default commitment scheme.
+  zkp_verification* first = zkp_new_cached_verification(cache, key_material);
+  assert(first);
+  int set =
+      zkp_set_verification_commitment_scheme(first, ZKP_COMMITMENT_SHA256);
+  assert(set);
+  zkp_free_verification(first);
+  zkp_verification* second = zkp_new_cached_verification(cache, key_material);
+  assert(second == first);
+  assert(second->commitment.scheme == params->commitment);
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.hits == 2 && stats.evictions == 0);
+
+  // Keys are evicted to stay within the budget, but remain usable by existing
+  // verifications, even after the cache has been freed.
+  for (unsigned int k = 4; k < n_keys; k++) {
+    run_cached_round(cache, private_keys[k], key_material + k * size);
+  }
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.n_keys == 4 && stats.misses == 6 && stats.evictions == 2);
+  assert(stats.memory_used <= budget);
+
+  // Invalid keys are rejected, and not cached.
+  unsigned char invalid[size];
+  memset(invalid, 0, size);
+  const zkp_verification* rejected =
+      zkp_new_cached_verification(cache, invalid);
+  assert(rejected == NULL);
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.n_keys == 4 && stats.misses == 7);
+
+  cache_test_job job = { cache, private_keys, key_material, n_keys };
+  pthread_t threads[4];
+  for (unsigned int i = 0; i < 4; i++) {
+    int ret = pthread_create(&threads[i], NULL, run_cached_rounds, &job);
+    assert(ret == 0);
+  }
+  for (unsigned int i = 0; i < 4; i++) {
+    int ret = pthread_join(threads[i], NULL);
+    assert(ret == 0);
+  }
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.hits + stats.misses == 7 + 2 + 4 * 64);
+  assert(stats.n_keys == 4);
+  zkp_free_public_key_cache(cache);
+
+  // With room for a single key, each insertion evicts the key that another
+  // thread may be looking up at the same time.
+  cache = zkp_new_public_key_cache(params, budget / 4);
+  assert(cache);
+  job.cache = cache;
+  pthread_t lookup_thread;
+  int ret = pthread_create(&lookup_thread, NULL, look_up_first_key, &job);
+  assert(ret == 0);
+  for (unsigned int i = 0; i < 256; i++) {
+    const unsigned int k = 1 + i % (n_keys - 1);
+    zkp_verification* verification =
+        zkp_new_cached_verification(cache, key_material + k * size);
+    assert(verification);
+    zkp_free_verification(verification);
+  }
+  ret = pthread_join(lookup_thread, NULL);
+  assert(ret == 0);
+  zkp_get_public_key_cache_stats(cache, &stats);
+  assert(stats.n_keys == 1 && stats.hits + stats.misses == 2 * 256);
+  assert(stats.memory_used <= budget / 4);
+  zkp_free_public_key_cache(cache);
+
+  zkp_proof* proof = zkp_new_proof(private_keys[0]);
+  assert(proof);
+  const unsigned char* commitments = zkp_begin_round(proof);
+  unsigned int q = zkp_choose_question(second);
+  int ok = zkp_verify(second, commitments, zkp_get_answer(proof, q));
+  assert(ok);
+  zkp_free_proof(proof);
+  zkp_free_verification(second);
+  for (unsigned int k = 0; k < n_keys; k++) {
+    zkp_free_private_key(private_keys[k]);
+  }
 }
 
 static void test_precomputed_vectors_3x3x3(void) {
@@ -269,36 +1209,94 @@ static void test_precomputed_vectors_s53ast(void) {
   zkp_free_public_key(key);
 }
 
+static void* get_params_s41(void* arg) {
+  (void) arg;
+  return (void*) zkp_params_s41();
+}
+
+static void test_concurrent_init(void) {
+  // All threads must wait for the same, single initialization.
+  pthread_t threads[4];
+  for (unsigned int i = 0; i < 4; i++) {
+    int ret = pthread_create(&threads[i], NULL, get_params_s41, NULL);
+    assert(ret == 0);
+  }
+  for (unsigned int i = 0; i < 4; i++) {
+    void* params;
+    int ret = pthread_join(threads[i], &params);
+    assert(ret == 0);
+    assert(params == zkp_params_s41());
+  }
+
+  // Initialize the remaining parameter sets using multiple threads.
+  zkp_params_preload(3);
+}
+
 int main(void) {
+  test_random();
+  test_random_permutations();
+  test_shuffle_kernels();
+  test_gather_kernels();
+  test_sha256_kernels();
+  test_concurrent_init();
+
   const unsigned int n_rounds_3x3x3 = 510;
   test_params(zkp_params_3x3x3(), n_rounds_3x3x3);
   test_is_key_pair(zkp_params_3x3x3());
+  test_permutation_engine(zkp_params_3x3x3());
+  test_index_of_permutation(zkp_params_3x3x3());
+  test_h_reprs(zkp_params_3x3x3());
+  test_stabilizer_chain(zkp_params_3x3x3(), order_3x3x3_exponents);
   test_import_export(zkp_params_3x3x3());
+  test_insecure_seed(zkp_params_3x3x3());
+  test_commitment_schemes(zkp_params_3x3x3());
+  test_public_key_cache(zkp_params_3x3x3());
 
   const unsigned int n_rounds_5x5x5 = 884;
   test_params(zkp_params_5x5x5(), n_rounds_5x5x5);
   test_is_key_pair(zkp_params_5x5x5());
+  test_permutation_engine(zkp_params_5x5x5());
+  test_index_of_permutation(zkp_params_5x5x5());
+  test_h_reprs(zkp_params_5x5x5());
+  test_stabilizer_chain(zkp_params_5x5x5(), NULL);
   test_import_export(zkp_params_5x5x5());
+  test_insecure_seed(zkp_params_5x5x5());
+  test_commitment_schemes(zkp_params_5x5x5());
 
   const unsigned int n_rounds_s41 = 260;
   test_params(zkp_params_s41(), n_rounds_s41);
   test_is_key_pair(zkp_params_s41());
+  test_permutation_engine(zkp_params_s41());
+  test_index_of_permutation(zkp_params_s41());
+  test_table_cache(zkp_params_s41());
   test_import_export(zkp_params_s41());
+  test_insecure_seed(zkp_params_s41());
+  test_commitment_schemes(zkp_params_s41());
+  test_public_key_cache(zkp_params_s41());
 
   const unsigned int n_rounds_s41ast = 239;
   test_params(zkp_params_s41ast(), n_rounds_s41ast);
   test_is_key_pair(zkp_params_s41ast());
+  test_permutation_engine(zkp_params_s41ast());
+  test_index_of_permutation(zkp_params_s41ast());
   test_import_export(zkp_params_s41ast());
+  test_insecure_seed(zkp_params_s41ast());
 
   const unsigned int n_rounds_s43ast = 219;
   test_params(zkp_params_s43ast(), n_rounds_s43ast);
   test_is_key_pair(zkp_params_s43ast());
+  test_permutation_engine(zkp_params_s43ast());
+  test_index_of_permutation(zkp_params_s43ast());
   test_import_export(zkp_params_s43ast());
+  test_insecure_seed(zkp_params_s43ast());
 
   const unsigned int n_rounds_s53ast = 260;
   test_params(zkp_params_s53ast(), n_rounds_s53ast);
   test_is_key_pair(zkp_params_s53ast());
+  test_permutation_engine(zkp_params_s53ast());
+  test_index_of_permutation(zkp_params_s53ast());
   test_import_export(zkp_params_s53ast());
+  test_insecure_seed(zkp_params_s53ast());
 
   test_precomputed_vectors_3x3x3();
   test_precomputed_vectors_5x5x5();
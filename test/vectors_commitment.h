@@ -0,0 +1,62 @@
+#define TEST_COMMITMENT_HMAC_SHA256                                            \
+  { 211, 139, 66, 9, 109, 128, 244, 95, 130, 107, 68, 169, 213, 96, 125, 231,  \
+    36, 150, 164, 21, 211, 244, 161, 168, 200, 142, 59, 185, 218, 141, 193,    \
+    203 },                                                                     \
+  { 42, 36, 208, 8, 120, 157, 60, 116, 218, 245, 224, 38, 54, 198, 117, 223,   \
+    143, 9, 236, 94, 116, 12, 27, 223, 99, 5, 249, 38, 31, 123, 28, 50 },      \
+  { 33, 217, 218, 235, 3, 251, 81, 227, 80, 233, 132, 120, 102, 62, 20, 102,   \
+    151, 119, 92, 204, 204, 34, 102, 28, 121, 146, 64, 232, 129, 218, 240,     \
+    54 },                                                                      \
+  { 62, 155, 115, 221, 145, 234, 34, 163, 242, 169, 44, 30, 94, 236, 131,      \
+    249, 198, 73, 208, 238, 201, 250, 200, 234, 229, 156, 242, 69, 8, 127,     \
+    240, 207 },                                                                \
+  { 230, 106, 79, 255, 152, 91, 229, 55, 18, 253, 74, 160, 137, 44, 59, 128,   \
+    152, 62, 144, 43, 108, 170, 62, 152, 237, 17, 134, 192, 168, 156, 122,     \
+    254 },                                                                     \
+  { 178, 114, 112, 101, 16, 25, 87, 191, 39, 206, 155, 80, 16, 76, 96, 98,     \
+    224, 195, 118, 183, 29, 243, 108, 179, 54, 210, 105, 72, 16, 58, 253,      \
+    59 },                                                                      \
+  { 71, 96, 67, 137, 250, 251, 106, 183, 144, 123, 156, 9, 226, 53, 137, 255,  \
+    2, 3, 56, 67, 130, 191, 123, 221, 235, 214, 19, 10, 55, 255, 163, 121 },   \
+  { 180, 111, 242, 18, 163, 160, 117, 131, 200, 221, 80, 198, 116, 198, 207,   \
+    243, 85, 142, 111, 123, 91, 151, 8, 31, 124, 115, 16, 26, 43, 0, 134,      \
+    251 },                                                                     \
+  { 74, 163, 235, 228, 164, 244, 8, 80, 160, 172, 79, 118, 178, 10, 173, 166,  \
+    24, 110, 58, 165, 95, 188, 114, 255, 54, 204, 17, 158, 10, 14, 243,        \
+    235 },                                                                     \
+  { 229, 1, 45, 251, 42, 151, 46, 218, 145, 84, 37, 247, 19, 133, 177, 69,     \
+    101, 169, 251, 13, 233, 47, 11, 211, 119, 5, 87, 65, 25, 105, 74, 83 },    \
+  { 90, 114, 50, 241, 50, 6, 122, 139, 216, 160, 33, 106, 142, 73, 45, 89,     \
+    244, 182, 178, 238, 63, 93, 67, 228, 136, 3, 114, 137, 117, 168, 125,      \
+    33 }
+
+#define TEST_COMMITMENT_SHA256                                                 \
+  { 99, 13, 205, 41, 102, 196, 51, 102, 145, 18, 84, 72, 187, 178, 91, 79,     \
+    244, 18, 164, 156, 115, 45, 178, 200, 171, 193, 184, 88, 27, 215, 16,      \
+    221 },                                                                     \
+  { 148, 76, 83, 56, 118, 249, 222, 55, 187, 168, 112, 205, 27, 180, 209, 12,  \
+    145, 176, 34, 164, 89, 203, 188, 162, 28, 76, 23, 69, 191, 226, 68,        \
+    180 },                                                                     \
+  { 128, 204, 130, 68, 51, 5, 159, 246, 179, 193, 156, 71, 194, 110, 173,      \
+    207, 14, 201, 173, 93, 114, 23, 21, 49, 4, 15, 174, 142, 110, 100, 64,     \
+    102 },                                                                     \
+  { 192, 42, 177, 38, 81, 58, 240, 13, 126, 244, 242, 194, 103, 249, 60, 3,    \
+    166, 58, 47, 136, 62, 117, 29, 42, 1, 132, 241, 240, 40, 161, 242, 176 },  \
+  { 254, 164, 179, 221, 189, 53, 161, 152, 75, 175, 92, 149, 162, 133, 41,     \
+    193, 119, 145, 197, 175, 72, 11, 82, 209, 5, 120, 186, 5, 226, 165, 41,    \
+    216 },                                                                     \
+  { 146, 236, 202, 21, 11, 218, 227, 220, 97, 15, 58, 171, 231, 218, 109,      \
+    153, 85, 4, 2, 170, 1, 102, 216, 95, 53, 161, 138, 84, 105, 48, 164,       \
+    115 },                                                                     \
+  { 172, 184, 77, 227, 240, 32, 118, 66, 144, 138, 130, 116, 12, 202, 230,     \
+    191, 2, 205, 68, 144, 53, 106, 66, 76, 135, 249, 94, 4, 24, 37, 2, 231 },  \
+  { 195, 126, 29, 135, 81, 175, 243, 115, 57, 138, 255, 19, 121, 3, 223, 125,  \
+    201, 7, 233, 62, 83, 178, 35, 126, 61, 23, 93, 167, 239, 91, 164, 66 },    \
+  { 200, 248, 12, 209, 22, 235, 251, 173, 187, 202, 41, 50, 71, 199, 230,      \
+    213, 139, 121, 137, 152, 124, 22, 19, 189, 243, 208, 74, 252, 92, 7, 27,   \
+    54 },                                                                      \
+  { 240, 27, 105, 11, 251, 17, 48, 234, 158, 29, 233, 102, 167, 146, 62, 38,   \
+    56, 210, 154, 218, 152, 56, 214, 133, 27, 123, 16, 47, 7, 171, 31, 96 },   \
+  { 112, 176, 201, 115, 144, 166, 181, 14, 171, 186, 219, 217, 121, 196, 147,  \
+    227, 115, 130, 255, 94, 242, 169, 7, 225, 157, 117, 165, 232, 87, 62,      \
+    121, 23 }